@@ -280,21 +280,21 @@ using namespace AdaptiveCards;
 + (std::string)getLocalizedDate:(std::string const &)text language:(std::string const &)language
 {
     std::string dateParsedString;
-    std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparsedTokens = DateTimePreparser(text).GetTextTokens();
-    for (auto section : DateTimePreparsedTokens) {
-        if (section->GetFormat() != DateTimePreparsedTokenFormat::RegularString) {
+    const DateTimePreparser preparser(text);
+    for (const auto &section : preparser.GetTokens()) {
+        if (section.GetFormat() != DateTimePreparsedTokenFormat::RegularString) {
             NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
             [formatter setDateFormat:@"MM/dd/yyyy"];
             /// date format has been already verified by preparsed token
-            std::string givenDate = std::to_string(section->GetMonth() + 1) + "/" + std::to_string(section->GetDay()) + "/" + std::to_string(section->GetYear());
+            std::string givenDate = std::to_string(section.GetMonth() + 1) + "/" + std::to_string(section.GetDay()) + "/" + std::to_string(section.GetYear());
             NSString *nsString = [NSString stringWithCString:givenDate.c_str() encoding:NSUTF8StringEncoding];
             NSDate *date = [formatter dateFromString:nsString];
             // specify output date format
             NSDateFormatter *outputFormatter = [[NSDateFormatter alloc] init];
             outputFormatter.timeStyle = NSDateFormatterNoStyle;
-            if (section->GetFormat() == DateTimePreparsedTokenFormat::DateCompact) {
+            if (section.GetFormat() == DateTimePreparsedTokenFormat::DateCompact) {
                 outputFormatter.dateStyle = NSDateFormatterShortStyle;
-            } else if (section->GetFormat() == DateTimePreparsedTokenFormat::DateShort) {
+            } else if (section.GetFormat() == DateTimePreparsedTokenFormat::DateShort) {
                 outputFormatter.dateStyle = NSDateFormatterMediumStyle;
             } else {
                 outputFormatter.dateStyle = NSDateFormatterLongStyle;
@@ -307,7 +307,7 @@ using namespace AdaptiveCards;
             NSString *dateInLocalLanguage = [outputFormatter stringFromDate:date];
             dateParsedString += [dateInLocalLanguage UTF8String];
         } else {
-            dateParsedString += section->GetText();
+            dateParsedString += section.GetText();
         }
     }
     return dateParsedString;
@@ -209,5 +209,30 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual("{\"actions\":[],\"body\":[{\"text\":\"Standard textblock\",\"type\":\"TextBlock\"},{\"property\":\"value\",\"someOtherProperty\":\"some other value\",\"type\":\"SomeRandomType\"}],\"type\":\"AdaptiveCard\",\"version\":\"1.0\"}\n"s,
                 outputCard);
         }
+
+        TEST_METHOD(KnownPropertiesArePerTypeTest)
+        {
+            // "wrap" is known to TextBlock but not to Image, "url" the other way around. Every instance of a type
+            // shares one set of known properties, so make sure the types don't bleed into each other.
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"body\": [\
+                    { \"type\": \"TextBlock\", \"text\": \"one\", \"wrap\": true, \"url\": \"https://adaptivecards.io\" },\
+                    { \"type\": \"Image\", \"url\": \"https://adaptivecards.io/content/cats/1.png\", \"wrap\": true },\
+                    { \"type\": \"TextBlock\", \"text\": \"two\", \"wrap\": true }\
+                ]\
+            }";
+            std::shared_ptr<ParseResult> parseResult = AdaptiveCard::DeserializeFromString(testJsonString, "1.0");
+            const auto& body = parseResult->GetAdaptiveCard()->GetBody();
+
+            Assert::AreEqual("{\"url\":\"https://adaptivecards.io\"}\n"s, ParseUtil::JsonToString(body.at(0)->GetAdditionalProperties()));
+            Assert::AreEqual("{\"wrap\":true}\n"s, ParseUtil::JsonToString(body.at(1)->GetAdditionalProperties()));
+            Assert::IsTrue(body.at(2)->GetAdditionalProperties().isNull());
+
+            AdaptiveCard emptyCard;
+            Assert::IsTrue(emptyCard.GetKnownProperties().count("body") == 1);
+        }
     };
 }
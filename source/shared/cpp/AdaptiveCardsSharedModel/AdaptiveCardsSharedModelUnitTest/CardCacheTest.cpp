@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include "CardCache.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "ParseUtil.h"
+#include "UnknownElement.h"
+
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace
+{
+    std::string MakeCard(const std::string& text)
+    {
+        return R"({ "type": "AdaptiveCard", "version": "1.0", "body": [ { "type": "TextBlock", "text": ")" + text + R"(" } ] })";
+    }
+
+    class TestElementParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& value) override
+        {
+            return UnknownElementParser().Deserialize(context, value);
+        }
+        std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+        {
+            return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+        }
+    };
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(CardCacheTest)
+    {
+    public:
+        TEST_METHOD(HitsAndMissesTest)
+        {
+            // room for two cards
+            const size_t cardSize = MakeCard("first").size();
+            CardCache cache(2 * cardSize);
+            Assert::AreEqual(2 * cardSize, cache.GetCapacityInBytes());
+
+            const auto first = cache.DeserializeFromString(MakeCard("first"), "1.0");
+            Assert::IsTrue(first == cache.DeserializeFromString(MakeCard("first"), "1.0"));
+            Assert::AreNotEqual(std::string::npos, first->GetCard()->Serialize().find("\"first\""));
+            Assert::AreEqual(cardSize, cache.GetSizeInBytes());
+
+            // the renderer version is part of the key
+            Assert::IsFalse(first == cache.DeserializeFromString(MakeCard("first"), "1.1"));
+
+            auto counters = cache.GetCounters();
+            Assert::AreEqual(1ull, counters.hits);
+            Assert::AreEqual(2ull, counters.misses);
+            Assert::AreEqual(0ull, counters.evictions);
+            Assert::AreEqual(static_cast<size_t>(2), cache.GetSize());
+            Assert::AreEqual(2 * cardSize, cache.GetSizeInBytes());
+
+            // "first" at 1.0 was used less recently than "first" at 1.1, so it makes room for "third"
+            cache.DeserializeFromString(MakeCard("third"), "1.0");
+            Assert::AreEqual(1ull, cache.GetCounters().evictions);
+            Assert::IsFalse(first == cache.DeserializeFromString(MakeCard("first"), "1.0"));
+            Assert::AreEqual(2ull, cache.GetCounters().evictions);
+            Assert::AreEqual(static_cast<size_t>(2), cache.GetSize());
+
+            // a card bigger than the whole cache isn't kept, and doesn't push out the others
+            cache.DeserializeFromString(MakeCard(std::string(2 * cardSize, 'x')), "1.0");
+            Assert::AreEqual(static_cast<size_t>(2), cache.GetSize());
+            Assert::AreEqual(2ull, cache.GetCounters().evictions);
+
+            cache.Clear();
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetSize());
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetSizeInBytes());
+            Assert::AreEqual(1ull, cache.GetCounters().hits);
+
+            // failures aren't kept
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { cache.DeserializeFromString("{ not json", "1.0"); });
+            Assert::AreEqual(static_cast<size_t>(0), cache.GetSize());
+
+            CardCache noCache(0);
+            const auto uncached = noCache.DeserializeFromString(MakeCard("first"), "1.0");
+            Assert::IsFalse(uncached == noCache.DeserializeFromString(MakeCard("first"), "1.0"));
+            Assert::AreEqual(static_cast<size_t>(0), noCache.GetSize());
+        }
+
+        TEST_METHOD(ContextTest)
+        {
+            const std::string card = MakeCard("text");
+            CardCache cache(10 * card.size());
+
+            // a context with default registrations shares results with every other one
+            ParseContext context;
+            const auto result = cache.DeserializeFromString(card, "1.0", context);
+            Assert::IsTrue(result == cache.DeserializeFromString(card, "1.0"));
+            Assert::IsTrue(context.warnings.empty());
+
+            ParseContext german;
+            german.SetLanguage("de");
+            const auto germanResult = cache.DeserializeFromString(card, "1.0", german);
+            Assert::IsFalse(result == germanResult);
+            Assert::AreEqual("de"s, germanResult->GetCard()->GetLanguage());
+
+            // as does any other setting that changes what a parse gives
+            ParseContext indexing;
+            indexing.SetBuildsElementIndex(true);
+            Assert::IsFalse(result == cache.DeserializeFromString(card, "1.0", indexing));
+            ParseContext emphasis;
+            emphasis.SetParentalContainerStyle(ContainerStyle::Emphasis);
+            Assert::IsFalse(result == cache.DeserializeFromString(card, "1.0", emphasis));
+
+            // the warnings of a parse go with its result, rather than into the caller's context
+            ParseContext warned;
+            const auto empty = cache.DeserializeFromString(MakeCard(""), "1.0", warned);
+            Assert::IsTrue(warned.warnings.empty());
+            Assert::AreEqual(static_cast<size_t>(1), empty->GetWarnings().size());
+            Assert::IsTrue(WarningStatusCode::RequiredPropertyMissing == empty->GetWarnings().at(0)->GetStatusCode());
+
+            // changing a registration changes which results it gets
+            auto elementRegistration = std::make_shared<ElementParserRegistration>();
+            ParseContext custom(elementRegistration, nullptr);
+            Assert::IsTrue(result == cache.DeserializeFromString(card, "1.0", custom));
+
+            const auto parser = std::make_shared<TestElementParser>();
+            elementRegistration->AddParser("Custom", parser);
+            const auto customResult = cache.DeserializeFromString(card, "1.0", custom);
+            Assert::IsFalse(result == customResult);
+            Assert::IsTrue(customResult == cache.DeserializeFromString(card, "1.0", custom));
+
+            // registering the same parser again is a change too, as is removing it
+            elementRegistration->AddParser("Custom", parser);
+            Assert::IsFalse(customResult == cache.DeserializeFromString(card, "1.0", custom));
+            elementRegistration->RemoveParser("Custom");
+            Assert::IsFalse(result == cache.DeserializeFromString(card, "1.0", custom));
+        }
+
+        TEST_METHOD(ConcurrentTest)
+        {
+            constexpr size_t threadCount = 8;
+            constexpr size_t parsesPerThread = 200;
+            CardCache cache(4 * MakeCard("card 0").size());
+
+            std::vector<std::thread> threads;
+            std::vector<std::vector<std::string>> serialized(threadCount);
+            for (size_t thread = 0; thread < threadCount; thread++)
+            {
+                threads.emplace_back([&, thread]() {
+                    ParseContext context;
+                    for (size_t i = 0; i < parsesPerThread; i++)
+                    {
+                        const std::string text = "card " + std::to_string((thread + i) % 6);
+                        serialized[thread].push_back(cache.DeserializeFromString(MakeCard(text), "1.0", context)->GetCard()->Serialize());
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (size_t thread = 0; thread < threadCount; thread++)
+            {
+                for (size_t i = 0; i < parsesPerThread; i++)
+                {
+                    const std::string text = "card " + std::to_string((thread + i) % 6);
+                    Assert::AreNotEqual(std::string::npos, serialized[thread][i].find(text));
+                }
+            }
+
+            const auto counters = cache.GetCounters();
+            Assert::AreEqual(static_cast<unsigned long long>(threadCount * parsesPerThread), counters.hits + counters.misses);
+            Assert::IsTrue(cache.GetSize() <= 4);
+        }
+    };
+}
@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include "Container.h"
+#include "ParseResult.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace
+{
+    const std::string c_card = R"({
+        "type": "AdaptiveCard",
+        "version": "1.5",
+        "body": [
+            { "type": "TextBlock", "id": "greeting", "text": "Hello" },
+            {
+                "type": "Container",
+                "id": "container",
+                "selectAction": { "type": "Action.Submit", "id": "containerAction" },
+                "items": [
+                    { "type": "TextBlock", "id": "name", "text": "{name}" },
+                    { "type": "TextBlock", "id": "sibling", "text": "unchanged" }
+                ]
+            }
+        ],
+        "actions": [
+            {
+                "type": "Action.ShowCard",
+                "id": "showCard",
+                "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "id": "nested", "text": "nested" } ] }
+            }
+        ]
+    })";
+
+    class CustomElement : public BaseCardElement
+    {
+    public:
+        CustomElement() : BaseCardElement(CardElementType::Custom)
+        {
+            SetElementTypeString("Custom");
+        }
+    };
+
+    std::string GetText(const std::shared_ptr<BaseElement>& element)
+    {
+        return std::static_pointer_cast<TextBlock>(element)->GetText();
+    }
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(CloneTest)
+    {
+    public:
+        TEST_METHOD(CloneSharesElementsTest)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+            const auto clone = card->Clone();
+
+            Assert::IsTrue(clone != card);
+            Assert::AreEqual(card->Serialize(), clone->Serialize());
+            Assert::IsTrue(clone->GetBody()[0] == card->GetBody()[0]);
+            Assert::IsTrue(clone->GetActions()[0] == card->GetActions()[0]);
+            Assert::IsTrue(card->GetBody()[0]->IsShared());
+            Assert::IsTrue(card->GetActions()[0]->IsShared());
+            Assert::IsFalse(clone->IsShared());
+
+            // the lists are the clone's own
+            clone->GetBody().pop_back();
+            Assert::AreEqual(static_cast<size_t>(2), card->GetBody().size());
+
+            // an element's clone has its own properties but shares its children
+            const auto container = std::static_pointer_cast<Container>(card->GetBody()[1]);
+            const auto containerClone = std::static_pointer_cast<Container>(container->Clone());
+            Assert::IsTrue(container->GetInternalId() == containerClone->GetInternalId());
+            Assert::IsTrue(containerClone->GetItems()[0] == container->GetItems()[0]);
+            containerClone->SetIsVisible(false);
+            Assert::IsTrue(container->GetIsVisible());
+
+            const auto textBlock = std::static_pointer_cast<TextBlock>(card->GetBody()[0]);
+            const auto textBlockClone = std::static_pointer_cast<TextBlock>(textBlock->Clone());
+            textBlockClone->SetText("Goodbye");
+            Assert::AreEqual("Hello"s, textBlock->GetText());
+
+            // element types from elsewhere are copied as the class they derive from, unless they say otherwise
+            CustomElement custom;
+            custom.SetId("custom");
+            const auto customClone = std::static_pointer_cast<BaseCardElement>(custom.Clone());
+            Assert::AreEqual("custom"s, customClone->GetId());
+            Assert::AreEqual("Custom"s, customClone->GetElementTypeString());
+            Assert::IsTrue(CardElementType::Custom == customClone->GetElementType());
+            Assert::IsFalse(customClone->IsShared());
+        }
+
+        TEST_METHOD(GetElementForEditTest)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+            const std::string original = card->Serialize();
+            const auto clone = card->Clone();
+
+            auto name = clone->GetElementForEdit("name");
+            std::static_pointer_cast<TextBlock>(name)->SetText("Ada");
+            const auto nameCopy = name.get();
+            name.reset();
+            Assert::AreEqual(original, card->Serialize());
+            Assert::AreEqual("Ada"s, GetText(std::static_pointer_cast<Container>(clone->GetBody()[1])->GetItems()[0]));
+
+            // only the path to the element was copied
+            const auto container = std::static_pointer_cast<Container>(card->GetBody()[1]);
+            auto& containerClone = static_cast<Container&>(*clone->GetBody()[1]);
+            Assert::IsTrue(&containerClone != container.get());
+            Assert::IsTrue(containerClone.GetItems()[1] == container->GetItems()[1]);
+            Assert::IsTrue(containerClone.GetSelectAction() == container->GetSelectAction());
+            Assert::IsTrue(clone->GetBody()[0] == card->GetBody()[0]);
+            Assert::IsTrue(clone->GetActions()[0] == card->GetActions()[0]);
+
+            // what the clone alone holds isn't copied again
+            Assert::IsTrue(clone->GetElementForEdit("name").get() == nameCopy);
+            Assert::IsTrue(clone->GetElementForEdit("container").get() == &containerClone);
+
+            const auto action = std::static_pointer_cast<SubmitAction>(clone->GetElementForEdit("containerAction"));
+            Assert::IsTrue(action != container->GetSelectAction());
+            Assert::IsTrue(action == containerClone.GetSelectAction());
+            Assert::IsTrue(clone->GetBody()[1].get() == &containerClone);
+            action->SetTitle("Go");
+            Assert::AreEqual(""s, container->GetSelectAction()->GetTitle());
+
+            // nor is one that a caller still holds
+            Assert::IsTrue(clone->GetElementForEdit("containerAction") == action);
+
+            // the original is protected from the clone's edits, and the clone from the original's
+            card->GetElementForEdit("greeting")->SetId("changed");
+            Assert::AreEqual("greeting"s, clone->GetBody()[0]->GetId());
+
+            Assert::IsTrue(clone->GetElementForEdit("missing") == nullptr);
+        }
+
+        TEST_METHOD(GetElementForEditUnsharedTest)
+        {
+            // nothing in a card that has never been cloned is shared, so it is changed in place, even while held
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+            const auto greeting = card->GetBody()[0];
+            const auto nested = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0])->GetCard()->GetBody()[0];
+
+            Assert::IsTrue(card->GetElementForEdit("greeting") == greeting);
+            Assert::IsTrue(card->GetElementForEdit("nested") == nested);
+            Assert::IsTrue(card->GetElementForEdit("name") == std::static_pointer_cast<Container>(card->GetBody()[1])->GetItems()[0]);
+        }
+
+        TEST_METHOD(GetElementForEditInShowCardTest)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+            const auto clone = card->Clone();
+
+            std::static_pointer_cast<TextBlock>(clone->GetElementForEdit("nested"))->SetText("edited");
+
+            const auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0]);
+            const auto showCardClone = std::static_pointer_cast<ShowCardAction>(clone->GetActions()[0]);
+            Assert::IsTrue(showCardClone != showCard);
+            Assert::IsTrue(showCardClone->GetCard() != showCard->GetCard());
+            Assert::AreEqual("nested"s, GetText(showCard->GetCard()->GetBody()[0]));
+            Assert::AreEqual("edited"s, GetText(showCardClone->GetCard()->GetBody()[0]));
+        }
+    };
+}
@@ -0,0 +1,253 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include "FrozenCard.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "SampleCards.h"
+#include "TextBlock.h"
+#include "WorkerPool.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace
+{
+    std::string ParseToString(const std::string& json, ParseContext& context, std::vector<InternalId>* cardIds = nullptr)
+    {
+        try
+        {
+            const auto parseResult = AdaptiveCard::DeserializeFromString(json, "1.6", context);
+            if (cardIds != nullptr)
+            {
+                cardIds->push_back(parseResult->GetAdaptiveCard()->GetInternalId());
+            }
+            return parseResult->GetAdaptiveCard()->Serialize();
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            return "exception: "s + e.what();
+        }
+    }
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ConcurrentParsingTest)
+    {
+    public:
+        TEST_METHOD(ParseSamplesConcurrently)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            // registrations are shared between threads, contexts are not
+            auto elementRegistration = std::make_shared<ElementParserRegistration>();
+            auto actionRegistration = std::make_shared<ActionParserRegistration>();
+
+            std::vector<std::string> expected;
+            for (const auto& card : cards)
+            {
+                ParseContext context(elementRegistration, actionRegistration);
+                expected.push_back(ParseToString(card, context));
+            }
+
+            const unsigned int threadCount = std::max(4u, std::thread::hardware_concurrency());
+            constexpr size_t rounds = 3;
+            std::atomic<size_t> mismatches{0};
+            std::vector<std::vector<InternalId>> cardIds(threadCount);
+            std::vector<std::thread> threads;
+
+            for (unsigned int threadIndex = 0; threadIndex < threadCount; threadIndex++)
+            {
+                threads.emplace_back([&, threadIndex]() {
+                    for (size_t i = 0; i < cards.size() * rounds; i++)
+                    {
+                        // start each thread at a different card so they aren't all parsing the same one
+                        const size_t cardIndex = (i + threadIndex * cards.size() / threadCount) % cards.size();
+                        ParseContext context(elementRegistration, actionRegistration);
+                        if (ParseToString(cards[cardIndex], context, &cardIds[threadIndex]) != expected[cardIndex])
+                        {
+                            mismatches++;
+                        }
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Assert::AreEqual(static_cast<size_t>(0), mismatches.load());
+
+            // every card got its own internal id, even across threads
+            std::unordered_set<InternalId, InternalIdKeyHash> allCardIds;
+            size_t cardCount = 0;
+            for (const auto& ids : cardIds)
+            {
+                allCardIds.insert(ids.begin(), ids.end());
+                cardCount += ids.size();
+            }
+            Assert::AreEqual(cardCount, allCardIds.size());
+        }
+
+        TEST_METHOD(InternalIdsAreUniqueAcrossThreads)
+        {
+            constexpr unsigned int threadCount = 8;
+            constexpr size_t idsPerThread = 10000;
+            std::vector<std::vector<InternalId>> ids(threadCount);
+            std::vector<std::thread> threads;
+
+            for (unsigned int threadIndex = 0; threadIndex < threadCount; threadIndex++)
+            {
+                threads.emplace_back([&ids, threadIndex]() {
+                    for (size_t i = 0; i < idsPerThread; i++)
+                    {
+                        ids[threadIndex].push_back(InternalId::Next());
+                    }
+                    // Current() reports this thread's most recent id, whatever the other threads are doing
+                    if (InternalId::Current() != ids[threadIndex].back())
+                    {
+                        ids[threadIndex].clear();
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            std::unordered_set<InternalId, InternalIdKeyHash> allIds;
+            for (const auto& threadIds : ids)
+            {
+                Assert::AreEqual(idsPerThread, threadIds.size());
+                for (const auto& id : threadIds)
+                {
+                    Assert::IsTrue(id != InternalId::Invalid);
+                    allIds.insert(id);
+                }
+            }
+            Assert::AreEqual(threadCount * idsPerThread, allIds.size());
+        }
+
+        TEST_METHOD(InternalIdsOfExitedThreadsAreReused)
+        {
+            // a thread gives back what it didn't use of its block of ids, so the next thread carries on from there
+            // rather than claiming a new block
+            InternalId first;
+            std::thread([&first]() { first = InternalId::Next(); }).join();
+            InternalId second;
+            std::thread([&second]() { second = InternalId::Next(); }).join();
+            Assert::AreEqual(first.Hash() + 1, second.Hash());
+        }
+
+        TEST_METHOD(RenderFrozenSamplesConcurrently)
+        {
+            // what rendering a card reads: its JSON, and the processed text of its top level TextBlocks
+            const auto render = [](const AdaptiveCard& card) {
+                std::string rendered = card.Serialize();
+                for (const auto& element : card.GetBody())
+                {
+                    if (element->GetElementType() == CardElementType::TextBlock)
+                    {
+                        const auto textBlock = std::static_pointer_cast<TextBlock>(element);
+                        textBlock->GetTextForDateParsing();
+                        rendered += textBlock->GetMarkDownResult(textBlock->GetText())->html;
+                    }
+                }
+                return rendered;
+            };
+
+            std::vector<std::shared_ptr<const FrozenCard>> frozenCards;
+            std::vector<std::string> expected;
+            for (const auto& card : LoadSampleCards())
+            {
+                try
+                {
+                    const auto adaptiveCard = AdaptiveCard::DeserializeFromString(card, "1.6")->GetAdaptiveCard();
+                    expected.push_back(render(*adaptiveCard));
+                    frozenCards.push_back(FrozenCard::Freeze(adaptiveCard));
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                }
+            }
+            Assert::IsFalse(frozenCards.empty());
+
+            // every thread renders the same frozen cards, without copying them
+            const unsigned int threadCount = std::max(4u, std::thread::hardware_concurrency());
+            std::atomic<size_t> mismatches{0};
+            std::vector<std::thread> threads;
+            for (unsigned int thread = 0; thread < threadCount; thread++)
+            {
+                threads.emplace_back([&]() {
+                    for (size_t i = 0; i < frozenCards.size(); i++)
+                    {
+                        if (render(*frozenCards[i]->GetCard()) != expected[i])
+                        {
+                            mismatches++;
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            Assert::AreEqual(static_cast<size_t>(0), mismatches.load());
+        }
+
+        TEST_METHOD(DeserializeBatchTest)
+        {
+            auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            // make sure one of the cards fails, and that it doesn't take the rest of the batch with it
+            const size_t badCard = cards.size() / 2;
+            cards[badCard] = "{ \"type\": \"AdaptiveCard\", \"body\": [ { \"type\": \"Input.Text\", \"id\": \"a\" }, { \"type\": \"Input.Text\", \"id\": \"a\" } ] }";
+
+            std::vector<std::exception_ptr> errors;
+            const auto results = AdaptiveCard::DeserializeBatch(cards, "1.6", nullptr, nullptr, 4, &errors);
+            Assert::AreEqual(cards.size(), results.size());
+            Assert::AreEqual(cards.size(), errors.size());
+
+            for (size_t i = 0; i < cards.size(); i++)
+            {
+                ParseContext context;
+                const auto expected = ParseToString(cards[i], context);
+                if (results[i] != nullptr)
+                {
+                    Assert::IsTrue(errors[i] == nullptr);
+                    Assert::AreEqual(expected, results[i]->GetAdaptiveCard()->Serialize());
+                }
+                else
+                {
+                    Assert::IsTrue(errors[i] != nullptr);
+                    try
+                    {
+                        std::rethrow_exception(errors[i]);
+                    }
+                    catch (const AdaptiveCardParseException& e)
+                    {
+                        Assert::AreEqual(expected, "exception: "s + e.what());
+                    }
+                }
+            }
+
+            Assert::IsTrue(results[badCard] == nullptr);
+            Assert::IsTrue(AdaptiveCard::DeserializeBatch({}, "1.6").empty());
+
+            // later batches reuse the threads of the first rather than starting their own
+            const size_t threadCount = WorkerPool::GetShared().GetThreadCount();
+            Assert::AreEqual(cards.size(), AdaptiveCard::DeserializeBatch(cards, "1.6", nullptr, nullptr, 4).size());
+            Assert::AreEqual(threadCount, WorkerPool::GetShared().GetThreadCount());
+        }
+    };
+}
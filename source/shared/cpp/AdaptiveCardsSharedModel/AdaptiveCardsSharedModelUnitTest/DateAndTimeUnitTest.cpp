@@ -40,7 +40,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{TIME(2017-10-28T02:17:00Z)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             Assert::AreEqual<std::string>(preparser.GetTextTokens().front()->GetText(), "07:17 PM");
             Assert::IsTrue(preparser.GetTextTokens().front()->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
         }
@@ -52,7 +52,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{TIME(2017-10-27T18:19:09Z)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             Assert::AreEqual<std::string>(preparser.GetTextTokens().front()->GetText(), "11:19 AM");
             Assert::IsTrue(preparser.GetTextTokens().front()->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
         }
@@ -65,7 +65,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{TIME(2017-10-28T04:20:00+02:00)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             Assert::AreEqual<std::string>(preparser.GetTextTokens().front()->GetText(), "07:20 PM");
             Assert::IsTrue(preparser.GetTextTokens().front()->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
         }
@@ -78,7 +78,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{TIME(2017-10-28T11:25:00+09:00)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             Assert::AreEqual<std::string>(preparser.GetTextTokens().front()->GetText(), "07:25 PM");
             Assert::IsTrue(preparser.GetTextTokens().front()->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
         }
@@ -91,7 +91,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{TIME(2017-10-27T22:27:00-04:00)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             Assert::AreEqual<std::string>(preparser.GetTextTokens().front()->GetText(), "07:27 PM");
             Assert::IsTrue(preparser.GetTextTokens().front()->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
         }
@@ -106,7 +106,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText("{{DATE(2017-02-13T20:46:30Z, COMPACT)}}");
             Assert::AreEqual<std::string>("{{DATE(2017-02-13T20:46:30Z, COMPACT)}}",  blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-02-13T20:46:30Z, COMPACT)}}");
             Assert::IsTrue(token->GetDay() == 13 && token->GetMonth() == 1 && token->GetYear() == 2017);
@@ -121,7 +121,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(2017-10-28T04:20:00+02:00, COMPACT)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-10-28T04:20:00+02:00, COMPACT)}}");
             Assert::IsTrue(token->GetDay() == 27 && token->GetMonth() == 9 && token->GetYear() == 2017);
@@ -137,7 +137,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(2017-10-28T11:25:00+09:00, COMPACT)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-10-28T11:25:00+09:00, COMPACT)}}");
             Assert::IsTrue(token->GetDay() == 27 && token->GetMonth() == 9 && token->GetYear() == 2017);
@@ -152,7 +152,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(2017-10-27T22:27:00-04:00, COMPACT)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-10-27T22:27:00-04:00, COMPACT)}}");
             Assert::IsTrue(token->GetDay() == 27 && token->GetMonth() == 9 && token->GetYear() == 2017);
@@ -167,7 +167,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(2017-10-27T22:27:00-04:00,COMPACT)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-10-27T22:27:00-04:00,COMPACT)}}");
             Assert::IsTrue(token->GetDay() == 27 && token->GetMonth() == 9 && token->GetYear() == 2017);
@@ -242,7 +242,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("You have arrived in New York on {{DATE(2017-10-27T22:23:00Z, SHORT)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             Assert::AreEqual<std::string>(preparser.GetTextTokens().back()->GetText(), "{{DATE(2017-10-27T22:23:00Z, SHORT)}}");
             // Assert::AreEqual<std::string>(preparser.GetTextTokens().back()->GetText(), "9/27/2017");
             Assert::IsTrue(preparser.GetTextTokens().back()->GetFormat() == DateTimePreparsedTokenFormat::DateShort);
@@ -257,7 +257,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("You have arrived in New York on {{DATE(2017-10-27T22:27:00-04:00, SHORT)}} at {{TIME(2017-10-27T22:27:00-04:00)}}.\r have a good trip", blck.GetText());
 
-            DateTimePreparser block = blck.GetTextForDateParsing();
+            DateTimePreparser block = *blck.GetTextForDateParsing()
             const auto& tokens = block.GetTextTokens();
 
             Assert::AreEqual<std::string>(tokens[0]->GetText(), "You have arrived in New York on ");
@@ -286,7 +286,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("You will arrived in Seattle on {{DATE(2017-10-27T22:23:00Z, SHORT)}}; have a good trip", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             const auto& tokens = preparser.GetTextTokens();
 
             Assert::AreEqual<std::string>(tokens[0]->GetText(), "You will arrived in Seattle on ");
@@ -329,7 +329,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(2017-02-13T20:46:30Z)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-02-13T20:46:30Z)}}");
             Assert::IsTrue(token->GetDay() == 13 && token->GetMonth() == 1 && token->GetYear() == 2017);
@@ -343,7 +343,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(2017-02-13T20:46:30Z, LONG)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-02-13T20:46:30Z, LONG)}}");
             Assert::IsTrue(token->GetDay() == 13 && token->GetMonth() == 1 && token->GetYear() == 2017);
@@ -357,7 +357,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(2017-02-13T20:46:30Z, SHORT)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(2017-02-13T20:46:30Z, SHORT)}}");
             Assert::IsTrue(token->GetDay() == 13 && token->GetMonth() == 1 && token->GetYear() == 2017);
@@ -396,7 +396,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(1992-02-29T18:08:00Z)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(1992-02-29T18:08:00Z)}}");
             Assert::IsTrue(token->GetDay() == 29 && token->GetMonth() == 1 && token->GetYear() == 1992);
@@ -411,7 +411,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(1992-02-29T07:59:00Z)}}", blck.GetText());
 
-            DateTimePreparser preparser = blck.GetTextForDateParsing();
+            DateTimePreparser preparser = *blck.GetTextForDateParsing()
             std::shared_ptr<DateTimePreparsedToken> token(preparser.GetTextTokens().front());
             Assert::AreEqual<std::string>(token->GetText(), "{{DATE(1992-02-29T07:59:00Z)}}");
             Assert::IsTrue(token->GetDay() == 28 && token->GetMonth() == 1 && token->GetYear() == 1992);
@@ -424,5 +424,102 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(1994-02-29T06:08:00Z)}}", blck.GetText());
         }
+        TEST_METHOD(MacroAfterExtraCurlyBracketTest)
+        {
+            DateTimePreparser preparser("{{{DATE(2017-02-13T20:46:30Z,SHORT)}}}");
+            const auto& tokens = preparser.GetTokens();
+            Assert::AreEqual<size_t>(3, tokens.size());
+            Assert::AreEqual<std::string>("{", tokens[0].GetText());
+            Assert::AreEqual<std::string>("{{DATE(2017-02-13T20:46:30Z,SHORT)}}", tokens[1].GetText());
+            Assert::IsTrue(tokens[1].GetFormat() == DateTimePreparsedTokenFormat::DateShort);
+            Assert::AreEqual<std::string>("}", tokens[2].GetText());
+            Assert::IsTrue(preparser.HasDateTokens());
+        }
+        TEST_METHOD(UnmatchedMacrosStayTextTest)
+        {
+            const std::string unmatched[] = {
+                "{{DATE(2017-02-13T20:46:30Z, MEDIUM)}}",
+                "{{DATE(2017-02-13T20:46:30Z,  LONG)}}",
+                "{{DATE(2017-02-13T20:46:30Z,)}}",
+                "{{DATE(2017-02-13T20:46:30+0530)}}",
+                "{{DATE(2017-02-13T20:46:3Z)}}",
+                "{{DATE(2017-02-13 20:46:30Z)}}",
+                "{{date(2017-02-13T20:46:30Z)}}",
+                "{{DATE(2017-02-13T20:46:30Z)}",
+                "{{DATE(2017-02-13T20:46:30Z"};
+            for (const auto& text : unmatched)
+            {
+                DateTimePreparser preparser(text);
+                Assert::AreEqual<size_t>(1, preparser.GetTokens().size());
+                Assert::AreEqual(text, preparser.GetTokens().front().GetText());
+                Assert::IsTrue(preparser.GetTokens().front().GetFormat() == DateTimePreparsedTokenFormat::RegularString);
+                Assert::IsFalse(preparser.HasDateTokens());
+            }
+
+            // a TIME with a date format isn't a time
+            DateTimePreparser preparser("at {{TIME(2017-02-13T20:46:30Z, LONG)}}");
+            Assert::AreEqual<size_t>(2, preparser.GetTokens().size());
+            Assert::AreEqual<std::string>("{{TIME(2017-02-13T20:46:30Z, LONG)}}", preparser.GetTokens().back().GetText());
+            Assert::IsFalse(preparser.HasDateTokens());
+        }
+        TEST_METHOD(ReparseReplacesTokensTest)
+        {
+            DateTimePreparser preparser("{{DATE(2017-02-13T20:46:30Z, LONG)}} and {{DATE(2017-02-14T20:46:30-07:00)}}");
+            Assert::AreEqual<size_t>(3, preparser.GetTokens().size());
+            Assert::IsTrue(preparser.GetTokens().front().GetFormat() == DateTimePreparsedTokenFormat::DateLong);
+            Assert::IsTrue(preparser.GetTokens().back().GetFormat() == DateTimePreparsedTokenFormat::DateCompact);
+
+            // the shared_ptr tokens are copies of the same tokens
+            const auto textTokens = preparser.GetTextTokens();
+            Assert::AreEqual(preparser.GetTokens().size(), textTokens.size());
+            for (size_t i = 0; i < textTokens.size(); i++)
+            {
+                Assert::AreEqual(preparser.GetTokens()[i].GetText(), textTokens[i]->GetText());
+                Assert::IsTrue(preparser.GetTokens()[i].GetFormat() == textTokens[i]->GetFormat());
+            }
+
+            preparser.Parse("no dates here");
+            Assert::AreEqual<size_t>(1, preparser.GetTokens().size());
+            Assert::AreEqual<std::string>("no dates here", preparser.GetTokens().front().GetText());
+            Assert::IsFalse(preparser.HasDateTokens());
+
+            preparser.Parse("");
+            Assert::IsTrue(preparser.GetTokens().empty());
+        }
+    };
+
+    TEST_CLASS(SimpleDateTimeTest)
+    {
+    public:
+        TEST_METHOD(TryParseSimpleTimeTest)
+        {
+            unsigned int hours = 99, minutes = 99;
+            Assert::IsTrue(DateTimePreparser::TryParseSimpleTime("07:05", hours, minutes));
+            Assert::AreEqual(7u, hours);
+            Assert::AreEqual(5u, minutes);
+
+            for (const auto& time : {"7:05", "07:5", "07:05 ", " 07:05", "07-05", "25:00", "12:61", "", "0a:05"})
+            {
+                hours = minutes = 99;
+                Assert::IsFalse(DateTimePreparser::TryParseSimpleTime(time, hours, minutes));
+                Assert::AreEqual(99u, hours);
+                Assert::AreEqual(99u, minutes);
+            }
+        }
+        TEST_METHOD(TryParseSimpleDateTest)
+        {
+            unsigned int year = 0, month = 0, day = 0;
+            Assert::IsTrue(DateTimePreparser::TryParseSimpleDate("2020-02-29", year, month, day));
+            Assert::AreEqual(2020u, year);
+            Assert::AreEqual(2u, month);
+            Assert::AreEqual(29u, day);
+
+            for (const auto& date : {"2019-02-29", "2019-13-01", "2019-04-31", "2019-1-01", "12019-01-01", "2019-01-01T", "2019/01/01", ""})
+            {
+                year = month = day = 0;
+                Assert::IsFalse(DateTimePreparser::TryParseSimpleDate(date, year, month, day));
+                Assert::AreEqual(0u, year + month + day);
+            }
+        }
     };
 }
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include "Container.h"
+#include "ElementIndex.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "TextBlock.h"
+#include "ToggleVisibilityAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace
+{
+    const std::string c_card = R"({
+        "type": "AdaptiveCard",
+        "version": "1.5",
+        "selectAction": { "type": "Action.Submit", "id": "cardAction" },
+        "body": [
+            { "type": "TextBlock", "id": "first", "text": "first" },
+            {
+                "type": "Container",
+                "id": "section",
+                "items": [
+                    { "type": "TextBlock", "id": "details", "text": "details", "isVisible": false },
+                    { "type": "Input.Text", "id": "input", "inlineAction": { "type": "Action.Submit", "id": "inlineAction" } }
+                ]
+            },
+            {
+                "type": "Table",
+                "columns": [ { "width": 1 } ],
+                "rows": [ { "type": "TableRow", "cells": [ { "type": "TableCell", "id": "cell", "items": [] } ] } ]
+            },
+            {
+                "type": "TextBlock",
+                "id": "withFallback",
+                "text": "primary",
+                "fallback": { "type": "TextBlock", "id": "fallbackOnly", "text": "fallback" },
+                "requires": { "unknownFeature": "1.0" }
+            }
+        ],
+        "actions": [
+            { "type": "Action.ToggleVisibility", "id": "toggle", "targetElements": [ "details" ] },
+            {
+                "type": "Action.ShowCard",
+                "id": "showCard",
+                "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "id": "nested", "text": "nested" } ] }
+            }
+        ]
+    })";
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ElementIndexTest)
+    {
+    public:
+        TEST_METHOD(GetElementByIdTest)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+
+            for (const auto& id : {"cardAction", "first", "section", "details", "input", "inlineAction", "cell", "withFallback", "toggle", "showCard", "nested"})
+            {
+                const auto element = card->GetElementById(id);
+                Assert::IsTrue(element != nullptr);
+                Assert::AreEqual(std::string(id), element->GetId());
+            }
+            Assert::IsTrue(card->GetElementById("section") == card->GetBody()[1]);
+            Assert::IsTrue(card->GetElementById("fallbackOnly") == nullptr);
+            Assert::IsTrue(card->GetElementById("missing") == nullptr);
+
+            // what a renderer does when the toggle is clicked
+            const auto toggle = std::static_pointer_cast<ToggleVisibilityAction>(card->GetElementById("toggle"));
+            for (const auto& target : toggle->GetTargetElements())
+            {
+                const auto element = std::static_pointer_cast<BaseCardElement>(card->GetElementById(target->GetElementId()));
+                element->SetIsVisible(!element->GetIsVisible());
+            }
+            Assert::IsTrue(std::static_pointer_cast<BaseCardElement>(card->GetElementById("details"))->GetIsVisible());
+
+            ElementIndex index(*card);
+            Assert::AreEqual(static_cast<size_t>(11), index.GetSize());
+            std::vector<const BaseElement*> path;
+            Assert::IsTrue(index.Find(*card, "nested", &path) == card->GetElementById("nested"));
+            Assert::AreEqual(static_cast<size_t>(2), path.size());
+            Assert::IsTrue(path[0] == card->GetActions()[1].get());
+
+            // walking finds the same elements, by the same path
+            path.clear();
+            Assert::IsTrue(ElementIndex::FindByWalking(*card, "nested", &path) == card->GetElementById("nested"));
+            Assert::AreEqual(static_cast<size_t>(2), path.size());
+            Assert::IsTrue(path[0] == card->GetActions()[1].get());
+            Assert::IsTrue(ElementIndex::FindByWalking(*card, "inlineAction") == card->GetElementById("inlineAction"));
+            Assert::IsTrue(ElementIndex::FindByWalking(*card, "fallbackOnly") == nullptr);
+            path.clear();
+            Assert::IsTrue(ElementIndex::FindByWalking(*card, "missing", &path) == nullptr);
+            Assert::IsTrue(path.empty());
+        }
+
+        TEST_METHOD(IndexFollowsMovesTest)
+        {
+            ParseContext context;
+            context.SetBuildsElementIndex(true);
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5", context)->GetAdaptiveCard();
+
+            // elements that trade places, so that neither is where it was indexed, are both still found
+            std::swap(card->GetBody()[0], card->GetBody()[1]);
+            Assert::IsTrue(card->GetElementById("first") == card->GetBody()[1]);
+            Assert::IsTrue(card->GetElementById("section") == card->GetBody()[0]);
+            Assert::IsTrue(card->GetElementById("details") == std::static_pointer_cast<Container>(card->GetBody()[0])->GetItems()[0]);
+
+            // as is an element moved into another container
+            const auto section = std::static_pointer_cast<Container>(card->GetElementById("section"));
+            const auto first = card->GetBody()[1];
+            card->GetBody().erase(card->GetBody().begin() + 1);
+            section->GetItems().push_back(first);
+            Assert::IsTrue(card->GetElementById("first") == first);
+
+            // and GetElementForEdit, which goes by the same lookup, finds it there too
+            const auto clone = card->Clone();
+            const auto edited = clone->GetElementForEdit("first");
+            Assert::IsTrue(edited != nullptr);
+            Assert::IsTrue(edited == std::static_pointer_cast<Container>(clone->GetBody()[0])->GetItems().back());
+            Assert::IsTrue(card->GetElementById("first") == first);
+        }
+
+        TEST_METHOD(IndexFollowsChangesTest)
+        {
+            ParseContext context;
+            context.SetBuildsElementIndex(true);
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5", context)->GetAdaptiveCard();
+            const auto section = std::static_pointer_cast<Container>(card->GetElementById("section"));
+
+            // elements move when others are added in front of them
+            auto added = std::make_shared<TextBlock>();
+            added->SetId("added");
+            section->GetItems().insert(section->GetItems().begin(), added);
+            Assert::IsTrue(card->GetElementById("added") == added);
+            Assert::IsTrue(card->GetElementById("details") == section->GetItems()[1]);
+
+            // removed elements aren't found, even while something else still holds them
+            const auto details = section->GetItems()[1];
+            section->GetItems().erase(section->GetItems().begin() + 1);
+            Assert::IsTrue(card->GetElementById("details") == nullptr);
+
+            // an id that isn't in the card isn't found until an element is given it
+            Assert::IsTrue(card->GetElementById("later") == nullptr);
+            section->GetItems()[0]->SetId("later");
+            Assert::IsTrue(card->GetElementById("later") == added);
+            added->SetId("added");
+
+            // nor are ids that were changed
+            card->GetElementById("first")->SetId("renamed");
+            Assert::IsTrue(card->GetElementById("first") == nullptr);
+            Assert::IsTrue(card->GetElementById("renamed") == card->GetBody()[0]);
+
+            // a clone is indexed like the card it was made from, and GetElementForEdit finds elements the same way
+            const auto clone = card->Clone();
+            const auto edited = clone->GetElementForEdit("nested");
+            Assert::IsTrue(edited == clone->GetElementById("nested"));
+            Assert::IsFalse(edited == card->GetElementById("nested"));
+        }
+    };
+}
@@ -58,5 +58,65 @@ namespace AdaptiveCardsSharedModelUnitTest
         ENUM_TEST_WITH_REVERSE_MAP(TextSize, TextSize::Large, "Large"s, {{"Normal", TextSize::Default}});
         ENUM_TEST_WITH_REVERSE_MAP(TextWeight, TextWeight::Bolder, "Bolder"s, {{"Normal", TextWeight::Default}});
         ENUM_TEST(VerticalContentAlignment, VerticalContentAlignment::Center, "Center"s);
+
+        TEST_METHOD(EnumFromStringIgnoresCaseTest)
+        {
+            Assert::IsTrue(CardElementTypeFromString("textblock") == CardElementType::TextBlock);
+            Assert::IsTrue(CardElementTypeFromString("INPUT.TEXT") == CardElementType::TextInput);
+            Assert::IsTrue(TextWeightFromString("nORMAL") == TextWeight::Default);
+            Assert::IsTrue(ImageStyleFromString("Normal") == ImageStyle::Default);
+
+            // aliases are only accepted, never produced
+            Assert::AreEqual("Default"s, TextWeightToString(TextWeight::Default));
+            Assert::AreEqual("default"s, ImageStyleToString(ImageStyle::Default));
+
+            // near misses don't match
+            Assert::ExpectException<std::out_of_range>([]() { CardElementTypeFromString("TextBlocks"); });
+            Assert::ExpectException<std::out_of_range>([]() { CardElementTypeFromString("TextBloc"); });
+            Assert::ExpectException<std::out_of_range>([]() { CardElementTypeFromString(""); });
+        }
+
+        TEST_METHOD(SchemaKeysRoundTripTest)
+        {
+            for (int key = static_cast<int>(AdaptiveCardSchemaKey::Accent); key <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); key++)
+            {
+                const auto schemaKey = static_cast<AdaptiveCardSchemaKey>(key);
+                if (schemaKey == AdaptiveCardSchemaKey::ActionOrientation)
+                {
+                    // has no string
+                    Assert::ExpectException<std::out_of_range>([schemaKey]() { AdaptiveCardSchemaKeyToString(schemaKey); });
+                }
+                else if (schemaKey != AdaptiveCardSchemaKey::TextWeight)
+                {
+                    Assert::IsTrue(AdaptiveCardSchemaKeyFromString(AdaptiveCardSchemaKeyToString(schemaKey)) == schemaKey);
+                }
+            }
+
+            // TextWeight and Weight share a string, the later one wins
+            Assert::AreEqual(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Weight), AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextWeight));
+            Assert::IsTrue(AdaptiveCardSchemaKeyFromString("weight") == AdaptiveCardSchemaKey::Weight);
+        }
+
+        TEST_METHOD(SchemaKeysHashApartTest)
+        {
+            // every schema key gets a bucket of its own, whatever case it is looked up in
+            std::unordered_map<size_t, std::string> keysByHash;
+            for (int key = static_cast<int>(AdaptiveCardSchemaKey::Accent); key <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); key++)
+            {
+                const auto schemaKey = static_cast<AdaptiveCardSchemaKey>(key);
+                if (schemaKey == AdaptiveCardSchemaKey::ActionOrientation || schemaKey == AdaptiveCardSchemaKey::TextWeight)
+                {
+                    continue;
+                }
+
+                const std::string keyString = AdaptiveCardSchemaKeyToString(schemaKey);
+                std::string upper = keyString;
+                std::transform(upper.begin(), upper.end(), upper.begin(), [](char c) { return ToUpperAscii(c); });
+                Assert::AreEqual(CaseInsensitiveHash{}(keyString), CaseInsensitiveHash{}(upper));
+
+                const auto added = keysByHash.emplace(CaseInsensitiveHash{}(keyString), keyString);
+                Assert::IsTrue(added.second, (L"hash shared with " + std::wstring(added.first->second.begin(), added.first->second.end())).c_str());
+            }
+        }
     };
 }
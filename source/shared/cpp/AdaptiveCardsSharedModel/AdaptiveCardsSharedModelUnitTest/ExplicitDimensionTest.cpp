@@ -17,9 +17,11 @@
 #include "ToggleInput.h"
 #include "TextBlock.h"
 #include "Media.h"
+#include "Util.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
+using namespace std::string_literals;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
@@ -595,5 +597,136 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual<std::string>("20.5px", column->GetWidth());
             Assert::AreEqual<bool>(column->GetPixelWidth() == 20, true);
         }
+
+        TEST_METHOD(ParseDimensionTest)
+        {
+            ParsedDimension dimension;
+            Assert::IsTrue(ParseDimension("20px", dimension) == std::errc{});
+            Assert::IsTrue(dimension.unit == ParsedDimension::Unit::Pixels);
+            Assert::AreEqual(20, dimension.wholeValue);
+
+            Assert::IsTrue(ParseDimension("20.75px", dimension) == std::errc{});
+            Assert::AreEqual(20, dimension.wholeValue);
+            Assert::AreEqual(20.75, dimension.value, 1e-9);
+
+            Assert::IsTrue(ParseDimension("0.25", dimension) == std::errc{});
+            Assert::IsTrue(dimension.unit == ParsedDimension::Unit::Weight);
+            Assert::AreEqual(0.25, dimension.value, 1e-9);
+
+            Assert::IsTrue(ParseDimension("2147483647px", dimension) == std::errc{});
+            Assert::AreEqual(2147483647, dimension.wholeValue);
+
+            dimension = {};
+            Assert::IsTrue(ParseDimension("2147483648px", dimension) == std::errc::result_out_of_range);
+            for (const auto& invalid : {"", "px", "-1px", "1.px", ".5px", "1 px", "1PX", "1em", "1e3", "auto", "20px "})
+            {
+                Assert::IsTrue(ParseDimension(invalid, dimension) == std::errc::invalid_argument);
+            }
+            Assert::AreEqual(0, dimension.wholeValue);
+        }
+
+        TEST_METHOD(ParseSizeForPixelSizeWarningsTest)
+        {
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+            Assert::AreEqual(15, ParseSizeForPixelSize("15.9px", &warnings).value());
+            Assert::IsFalse(ParseSizeForPixelSize("stretch", &warnings).has_value());
+            Assert::IsTrue(warnings.empty());
+
+            // weights and zero-led sizes aren't pixel sizes
+            for (const auto& invalid : {"2.5", "0px", "05px", "-5px", "5 px"})
+            {
+                Assert::IsFalse(ParseSizeForPixelSize(invalid, &warnings).has_value());
+            }
+            Assert::AreEqual<size_t>(5, warnings.size());
+
+            Assert::IsFalse(ParseSizeForPixelSize("99999999999px", &warnings).has_value());
+            Assert::AreEqual<std::string>("out of range: 99999999999px", warnings.back()->GetReason());
+        }
+
+        TEST_METHOD(ParsedColumnWidthTest)
+        {
+            const std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.0",
+                "body": [
+                    {
+                        "type": "ColumnSet",
+                        "columns": [
+                            { "type": "Column", "width": "Auto" },
+                            { "type": "Column", "width": "stretch" },
+                            { "type": "Column" },
+                            { "type": "Column", "width": "1.5" },
+                            { "type": "Column", "width": 2 },
+                            { "type": "Column", "width": "40px" },
+                            { "type": "Column", "width": "0" },
+                            { "type": "Column", "width": "wide" }
+                        ]
+                    }
+                ]
+            })";
+
+            const auto parseResult = AdaptiveCard::DeserializeFromString(testJsonString, "1.0");
+            const auto columnSet = std::static_pointer_cast<ColumnSet>(parseResult->GetAdaptiveCard()->GetBody().front());
+            const auto& columns = columnSet->GetColumns();
+
+            const ColumnWidthType expectedTypes[] = {
+                ColumnWidthType::Auto,
+                ColumnWidthType::Stretch,
+                ColumnWidthType::Stretch,
+                ColumnWidthType::Weighted,
+                ColumnWidthType::Weighted,
+                ColumnWidthType::Pixels,
+                ColumnWidthType::Auto,
+                ColumnWidthType::Auto};
+            Assert::AreEqual(std::size(expectedTypes), columns.size());
+            for (size_t i = 0; i < columns.size(); i++)
+            {
+                Assert::IsTrue(expectedTypes[i] == columns[i]->GetParsedWidth().type);
+            }
+            Assert::AreEqual(1.0, columns[1]->GetParsedWidth().weight);
+            Assert::AreEqual(1.5, columns[3]->GetParsedWidth().weight);
+            Assert::AreEqual(2.0, columns[4]->GetParsedWidth().weight);
+            Assert::AreEqual(40u, columns[5]->GetParsedWidth().pixels);
+
+            // the parsed width follows the string
+            columns[0]->SetPixelWidth(25);
+            Assert::IsTrue(ColumnWidthType::Pixels == columns[0]->GetParsedWidth().type);
+            Assert::AreEqual(25u, columns[0]->GetParsedWidth().pixels);
+            columns[0]->SetWidth("3");
+            Assert::IsTrue(ColumnWidthType::Weighted == columns[0]->GetParsedWidth().type);
+            Assert::AreEqual(3.0, columns[0]->GetParsedWidth().weight);
+        }
+
+        TEST_METHOD(ResolveColumnWidthsTest)
+        {
+            ColumnSet columnSet;
+            for (const auto& width : {"auto", "100px", "stretch", "3", "hidden"})
+            {
+                auto column = std::make_shared<Column>();
+                column->SetWidth(width == "hidden"s ? "stretch" : width);
+                column->SetIsVisible(width != "hidden"s);
+                columnSet.GetColumns().push_back(column);
+            }
+
+            // 500 less 60 of auto column and 100 of pixels leaves 340, split 1:3
+            auto widths = columnSet.ResolveColumnWidths(500, {60, 0, 0, 0, 70});
+            const std::vector<double> expected = {60, 100, 85, 255, 0};
+            Assert::AreEqual(expected.size(), widths.size());
+            for (size_t i = 0; i < expected.size(); i++)
+            {
+                Assert::AreEqual(expected[i], widths[i], 1e-9);
+            }
+
+            // fixed columns keep their size when there's no room left for the others
+            widths = columnSet.ResolveColumnWidths(120);
+            Assert::AreEqual(0.0, widths[0]);
+            Assert::AreEqual(100.0, widths[1]);
+            Assert::AreEqual(5.0, widths[2], 1e-9);
+            Assert::AreEqual(15.0, widths[3], 1e-9);
+
+            widths = columnSet.ResolveColumnWidths(50);
+            Assert::AreEqual(100.0, widths[1]);
+            Assert::AreEqual(0.0, widths[2] + widths[3]);
+        }
     };
 }
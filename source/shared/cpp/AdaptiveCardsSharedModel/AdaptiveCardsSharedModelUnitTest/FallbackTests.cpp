@@ -522,6 +522,52 @@ namespace AdaptiveCardsSharedModelUnitTest
             AdaptiveCard::DeserializeFromString(cardStr, "1.2");
         }
 
+        TEST_METHOD(DuplicateIdBesideFallbackContent)
+        {
+            // the ids in the fallback content of the second "A" have nothing to do with the first
+            std::string cardStr = R"card({
+              "type": "AdaptiveCard",
+              "$schema": "http://adaptivecards.io/schemas/adaptive-card.json",
+              "version": "1.2",
+              "body": [
+                {
+                  "type": "TextBlock",
+                  "id": "A",
+                  "text": "First A"
+                },
+                {
+                  "type": "Container",
+                  "id": "A",
+                  "fallback": {
+                    "type": "Container",
+                    "id": "B",
+                    "items": [
+                      { "type": "TextBlock", "id": "C", "text": "C" },
+                      { "type": "TextBlock", "id": "D", "text": "D" },
+                      { "type": "TextBlock", "id": "E", "text": "E" }
+                    ]
+                  },
+                  "items": [
+                    {
+                      "type": "TextBlock",
+                      "text": "Second A"
+                    }
+                  ]
+                }
+              ]
+            })card";
+            try
+            {
+                AdaptiveCard::DeserializeFromString(cardStr, "1.2");
+                Assert::IsTrue(false, L"Deserializing should throw an exception");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::IdCollision == e.GetStatusCode(), L"ErrorStatusCode incorrect");
+                Assert::AreEqual("Collision detected for id 'A'", e.GetReason().c_str(), L"GetReason incorrect");
+            }
+        }
+
         TEST_METHOD(RequiresAndFallbackSerialization)
         {
             std::string cardStr = R"card({
@@ -597,6 +643,27 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsTrue(textBlockNoRequires->MeetsRequirements(featureRegistration));
         }
 
+        TEST_METHOD(FeatureVersionsAreParsedOnRegistration)
+        {
+            FeatureRegistration featureRegistration;
+            Assert::IsTrue(featureRegistration.GetFeatureSemanticVersion("foobar") == nullptr);
+            Assert::IsTrue(*featureRegistration.GetFeatureSemanticVersion("adaptiveCards") == SemanticVersion(c_sharedModelVersion));
+            Assert::IsTrue(featureRegistration.GetAdaptiveCardsVersion() == SemanticVersion(c_sharedModelVersion));
+
+            featureRegistration.AddFeature("foobar", "1.2.3");
+            Assert::IsTrue(*featureRegistration.GetFeatureSemanticVersion("FOOBAR") == SemanticVersion("1.2.3"));
+            Assert::AreEqual("1.2.3"s, featureRegistration.GetFeatureVersion("fooBar"));
+
+            // "*" is a valid registration, but not a semantic version
+            featureRegistration.AddFeature("anything", "*");
+            Assert::IsTrue(featureRegistration.GetFeatureSemanticVersion("anything") == nullptr);
+            Assert::AreEqual("*"s, featureRegistration.GetFeatureVersion("anything"));
+
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { featureRegistration.AddFeature("foobar", "1.2.4"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { featureRegistration.AddFeature("invalid", "1.x"); });
+            Assert::IsTrue(featureRegistration.GetFeatureSemanticVersion("invalid") == nullptr);
+        }
+
         TEST_METHOD(NestedFallbacksSerialization)
         {
             std::string cardStr = R"card({
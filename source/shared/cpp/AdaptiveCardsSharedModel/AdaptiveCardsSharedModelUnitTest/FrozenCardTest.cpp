@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include "Fact.h"
+#include "FactSet.h"
+#include "FrozenCard.h"
+#include "ParseResult.h"
+#include "RichTextBlock.h"
+#include "TextBlock.h"
+#include "TextRun.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace
+{
+    const std::string c_card = R"({
+        "type": "AdaptiveCard",
+        "version": "1.5",
+        "backgroundImage": "https://example.com/background.png",
+        "body": [
+            { "type": "TextBlock", "id": "plain", "text": "**bold** text" },
+            { "type": "TextBlock", "id": "dated", "text": "Due {{DATE(2017-10-27T22:27:00Z, SHORT)}}" },
+            {
+                "type": "Container",
+                "id": "container",
+                "selectAction": { "type": "Action.OpenUrl", "id": "containerAction", "url": "https://example.com" },
+                "items": [
+                    { "type": "Image", "id": "image", "url": "https://example.com/image.png" },
+                    {
+                        "type": "ColumnSet",
+                        "columns": [ { "type": "Column", "id": "column", "items": [ { "type": "RichTextBlock", "id": "rich", "inlines": [ "inline _text_" ] } ] } ]
+                    }
+                ]
+            },
+            {
+                "type": "TextBlock",
+                "id": "withFallback",
+                "text": "primary",
+                "fallback": { "type": "TextBlock", "id": "fallbackOnly", "text": "fallback" },
+                "requires": { "unknownFeature": "1.0" }
+            },
+            { "type": "FactSet", "id": "facts", "facts": [ { "title": "Due", "value": "{{DATE(2017-10-27T22:27:00Z, SHORT)}}" } ] }
+        ],
+        "actions": [
+            {
+                "type": "Action.ShowCard",
+                "id": "showCard",
+                "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "id": "nested", "text": "nested" } ] }
+            }
+        ]
+    })";
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(FrozenCardTest)
+    {
+    public:
+        TEST_METHOD(IndexAndResourcesTest)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+            const auto expectedResources = card->GetResourceInformation();
+            const auto frozen = FrozenCard::Freeze(card);
+
+            Assert::IsTrue(frozen->GetCard() == card);
+            Assert::AreEqual(expectedResources.size(), frozen->GetResourceInformation().size());
+            Assert::AreEqual("https://example.com/background.png"s, frozen->GetResourceInformation()[0].url);
+            Assert::AreEqual("https://example.com/image.png"s, frozen->GetResourceInformation()[1].url);
+
+            for (const auto& id : {"plain", "dated", "container", "containerAction", "image", "column", "rich", "withFallback", "showCard", "nested"})
+            {
+                const auto element = frozen->GetElementById(id);
+                Assert::IsTrue(element != nullptr);
+                Assert::AreEqual(std::string(id), element->GetId());
+            }
+            Assert::IsTrue(frozen->GetElementById("container") == card->GetBody()[2]);
+            Assert::IsTrue(frozen->GetElementById("fallbackOnly") == nullptr);
+            Assert::IsTrue(frozen->GetElementById("missing") == nullptr);
+        }
+
+        TEST_METHOD(TextIsProcessedWhenFrozenTest)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+            const auto plain = std::static_pointer_cast<TextBlock>(card->GetBody()[0]);
+            const auto dated = std::static_pointer_cast<TextBlock>(card->GetBody()[1]);
+            Assert::IsFalse(plain->GetMarkDownResult(plain->GetText()) == plain->GetMarkDownResult(plain->GetText()));
+
+            const auto frozen = FrozenCard::Freeze(card);
+            TextElementProperties::ResetMemoizationCounters();
+
+            // text without dates was transformed when the card was frozen
+            const auto markDown = plain->GetMarkDownResult(plain->GetText());
+            Assert::AreEqual("<p><strong>bold</strong> text</p>"s, markDown->html);
+            Assert::IsTrue(markDown == plain->GetMarkDownResult(plain->GetText()));
+            Assert::IsFalse(plain->GetTextForDateParsing()->HasDateTokens());
+
+            // text with dates is transformed once the renderer has formatted them, then kept
+            Assert::IsTrue(dated->GetTextForDateParsing()->HasDateTokens());
+            const auto datedMarkDown = dated->GetMarkDownResult("Due 10/27/2017");
+            Assert::IsTrue(datedMarkDown == dated->GetMarkDownResult("Due 10/27/2017"));
+
+            const auto counters = TextElementProperties::GetMemoizationCounters();
+            Assert::AreEqual(2ull, counters.dateParsingHits);
+            Assert::AreEqual(0ull, counters.dateParsingMisses);
+            Assert::AreEqual(3ull, counters.markDownHits);
+            Assert::AreEqual(1ull, counters.markDownMisses);
+
+            const auto rich = std::static_pointer_cast<const RichTextBlock>(frozen->GetElementById("rich"));
+            const auto textRun = std::static_pointer_cast<TextRun>(rich->GetInlines()[0]);
+            Assert::IsTrue(textRun->GetMarkDownResult(textRun->GetText()) == textRun->GetMarkDownResult(textRun->GetText()));
+
+            // changing the text thaws the element
+            plain->SetText("changed");
+            Assert::IsFalse(plain->GetMarkDownResult("changed") == plain->GetMarkDownResult("changed"));
+        }
+
+        TEST_METHOD(FactsArePreparsedWhenFrozenTest)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_card, "1.5")->GetAdaptiveCard();
+            const auto fact = std::static_pointer_cast<FactSet>(card->GetBody()[4])->GetFacts()[0];
+            Assert::IsFalse(fact->GetValueForDateParsing() == fact->GetValueForDateParsing());
+
+            const auto frozen = FrozenCard::Freeze(card);
+
+            // the title and value were preparsed when the card was frozen, and are handed out from then on
+            const auto title = fact->GetTitleForDateParsing();
+            const auto value = fact->GetValueForDateParsing();
+            Assert::IsFalse(title->HasDateTokens());
+            Assert::IsTrue(value->HasDateTokens());
+            Assert::IsTrue(title == fact->GetTitleForDateParsing());
+            Assert::IsTrue(value == fact->GetValueForDateParsing());
+
+            // changing the value thaws the fact, but leaves what was handed out as it was
+            fact->SetValue("never");
+            Assert::IsFalse(fact->GetValueForDateParsing()->HasDateTokens());
+            Assert::IsFalse(fact->GetValueForDateParsing() == fact->GetValueForDateParsing());
+            Assert::IsTrue(value->HasDateTokens());
+        }
+    };
+}
@@ -760,5 +760,134 @@ namespace AdaptiveCardsSharedModelUnitTest
             (void) parser3.TransformToHtml();
             Assert::AreEqual<bool>(true, parser3.IsEscaped());
         }
+
+        TEST_METHOD(LinkTest_UnclosedLinkDestinationTest)
+        {
+            MarkDownParser parser("[a](bc");
+            Assert::AreEqual<std::string>("<p>[a](bc</p>", parser.TransformToHtml());
+            Assert::AreEqual<bool>(false, parser.HasHtmlTags());
+
+            MarkDownParser parser1("[a](b(c) and [d](e)");
+            Assert::AreEqual<std::string>("<p>[a](b(c) and <a href=\"e\">d</a></p>", parser1.TransformToHtml());
+        }
+
+        TEST_METHOD(MarkDownEmphasisTest_UnmatchedRightEmphasisAfterLeftAndRightTest)
+        {
+            MarkDownParser parser("*.**");
+            Assert::AreEqual<std::string>("<p>*.**</p>", parser.TransformToHtml());
+            Assert::AreEqual<bool>(false, parser.HasHtmlTags());
+
+            MarkDownParser parser1("*.** *a*");
+            Assert::AreEqual<std::string>("<p>*.** <em>a</em></p>", parser1.TransformToHtml());
+        }
+
+        TEST_METHOD(PlainTextTest_IsPlainTextTest)
+        {
+            // long enough that the vectorized scan sees whole blocks, with the markdown in the last one
+            const std::string plain = "No markdown here, just text. Version 2 ships soon; it's 100% done!";
+            MarkDownParser parser(plain);
+            Assert::IsTrue(parser.IsPlainText());
+            Assert::AreEqual<std::string>("<p>" + plain + "</p>", parser.TransformToHtml());
+            Assert::AreEqual<bool>(false, parser.HasHtmlTags());
+            Assert::AreEqual<bool>(false, parser.IsEscaped());
+
+            Assert::IsTrue(MarkDownParser("").IsPlainText());
+            Assert::IsTrue(MarkDownParser("a backslash \\ and a . after text").IsPlainText());
+
+            for (const auto& syntax : {"*", "_", "[", "]", "(", ")", "-", "+", "\r", "\n", "<", ">", "&", "\"", "1."})
+            {
+                const std::string text = plain + syntax + " and more";
+                Assert::IsFalse(MarkDownParser(text).IsPlainText());
+                Assert::IsFalse(MarkDownParser(syntax).IsPlainText());
+            }
+
+            MarkDownParser parser1(plain + " **bold**");
+            Assert::IsFalse(parser1.IsPlainText());
+            Assert::AreEqual<std::string>("<p>" + plain + " <strong>bold</strong></p>", parser1.TransformToHtml());
+        }
+
+        TEST_METHOD(TextRunsTest_EmphasisTest)
+        {
+            MarkDownParser parser("Some **bold** and _italic_ ***both***");
+            const auto blocks = parser.TransformToBlocks();
+            Assert::AreEqual<size_t>(1, blocks.size());
+            Assert::IsTrue(blocks[0].type == MarkDownBlock::BlockType::Paragraph);
+            Assert::AreEqual<size_t>(1, blocks[0].items.size());
+
+            const auto& runs = blocks[0].items[0];
+            Assert::AreEqual<size_t>(6, runs.size());
+            Assert::AreEqual<std::string>("Some ", runs[0].text);
+            Assert::IsFalse(runs[0].isBold || runs[0].isItalic);
+            Assert::AreEqual<std::string>("bold", runs[1].text);
+            Assert::IsTrue(runs[1].isBold && !runs[1].isItalic);
+            Assert::AreEqual<std::string>(" and ", runs[2].text);
+            Assert::AreEqual<std::string>("italic", runs[3].text);
+            Assert::IsTrue(!runs[3].isBold && runs[3].isItalic);
+            Assert::AreEqual<std::string>(" ", runs[4].text);
+            Assert::AreEqual<std::string>("both", runs[5].text);
+            Assert::IsTrue(runs[5].isBold && runs[5].isItalic);
+
+            // the html is the same whichever is asked for first
+            Assert::AreEqual<std::string>(
+                "<p>Some <strong>bold</strong> and <em>italic</em> <strong><em>both</em></strong></p>",
+                parser.TransformToHtml());
+        }
+
+        TEST_METHOD(TextRunsTest_LinkTest)
+        {
+            MarkDownParser parser("see [a & **b**](http://x?a=1&b=\"2\") <now>");
+            const auto blocks = parser.TransformToBlocks();
+            Assert::AreEqual<size_t>(1, blocks.size());
+
+            const auto& runs = blocks[0].items[0];
+            Assert::AreEqual<size_t>(4, runs.size());
+            Assert::AreEqual<std::string>("see ", runs[0].text);
+            Assert::AreEqual<std::string>("", runs[0].linkUrl);
+            Assert::AreEqual<std::string>("a & ", runs[1].text);
+            Assert::AreEqual<std::string>("http://x?a=1&b=\"2\"", runs[1].linkUrl);
+            Assert::AreEqual<std::string>("b", runs[2].text);
+            Assert::IsTrue(runs[2].isBold);
+            Assert::AreEqual<std::string>("http://x?a=1&b=\"2\"", runs[2].linkUrl);
+            Assert::AreEqual<std::string>(" <now>", runs[3].text);
+            Assert::AreEqual<std::string>("", runs[3].linkUrl);
+        }
+
+        TEST_METHOD(TextRunsTest_ListTest)
+        {
+            MarkDownParser parser("intro\r3. one\r4. *two*\r- three\r\rafter");
+            const auto blocks = parser.TransformToBlocks();
+            Assert::AreEqual<size_t>(4, blocks.size());
+
+            Assert::IsTrue(blocks[0].type == MarkDownBlock::BlockType::Paragraph);
+            Assert::AreEqual<std::string>("intro", blocks[0].items[0][0].text);
+
+            Assert::IsTrue(blocks[1].type == MarkDownBlock::BlockType::OrderedList);
+            Assert::AreEqual<std::string>("3", blocks[1].start);
+            Assert::AreEqual<size_t>(2, blocks[1].items.size());
+            Assert::AreEqual<std::string>("one", blocks[1].items[0][0].text);
+            Assert::AreEqual<std::string>("two", blocks[1].items[1][0].text);
+            Assert::IsTrue(blocks[1].items[1][0].isItalic);
+
+            Assert::IsTrue(blocks[2].type == MarkDownBlock::BlockType::UnorderedList);
+            Assert::AreEqual<size_t>(1, blocks[2].items.size());
+            Assert::AreEqual<std::string>("three", blocks[2].items[0][0].text);
+
+            Assert::IsTrue(blocks[3].type == MarkDownBlock::BlockType::Paragraph);
+            Assert::AreEqual<std::string>("after", blocks[3].items[0].back().text);
+        }
+
+        TEST_METHOD(TextRunsTest_PlainTextTest)
+        {
+            const auto blocks = MarkDownParser("just text").TransformToBlocks();
+            Assert::AreEqual<size_t>(1, blocks.size());
+            Assert::IsTrue(blocks[0].type == MarkDownBlock::BlockType::Paragraph);
+            Assert::AreEqual<size_t>(1, blocks[0].items[0].size());
+            Assert::AreEqual<std::string>("just text", blocks[0].items[0][0].text);
+
+            const auto emptyBlocks = MarkDownParser("").TransformToBlocks();
+            Assert::AreEqual<size_t>(1, emptyBlocks.size());
+            Assert::AreEqual<size_t>(1, emptyBlocks[0].items.size());
+            Assert::IsTrue(emptyBlocks[0].items[0].empty());
+        }
     };
 }
@@ -739,5 +739,97 @@ namespace AdaptiveCardsSharedModelUnitTest
             const auto serializedCard = card->SerializeToJsonValue();
             Assert::IsTrue(serializedCard["body"][0]["isMultiline"].asBool());
         }
+
+        TEST_METHOD(DeserializeByElementMatchesDeserializeFromString)
+        {
+            const std::string testjson{ R"(
+                    {
+                        "type": "AdaptiveCard",
+                        // comments are allowed anywhere jsoncpp allows them
+                        "body": [
+                            {
+                                "type": "TextBlock",
+                                "text": "Brackets ] and braces } inside \"strings\" are fine"
+                            },
+                            {
+                                "columns": [ { "items": [ { "type": "Image", "url": "https://adaptivecards.io/content/cats/1.png" } ] } ],
+                                "type": "ColumnSet"
+                            },
+                            {
+                                "type": "Unknown.Element",
+                                "extra": [ 1, 2.5, true, null ]
+                            }
+                        ],
+                        "actions": [
+                            { "type": "Action.Submit", "title": "Submit" }
+                        ],
+                        "version": "1.5",
+                        "customProperty": { "nested": [ "value" ] }
+                    }
+                )"};
+
+            const auto expected = AdaptiveCard::DeserializeFromString(testjson, "1.5");
+            const auto actual = AdaptiveCard::DeserializeFromStringByElement(testjson, "1.5");
+
+            Assert::AreEqual(expected->GetAdaptiveCard()->Serialize(), actual->GetAdaptiveCard()->Serialize());
+            Assert::AreEqual(expected->GetWarnings().size(), actual->GetWarnings().size());
+            Assert::AreEqual(3ui64, actual->GetAdaptiveCard()->GetBody().size());
+            Assert::AreEqual(1ui64, actual->GetAdaptiveCard()->GetActions().size());
+        }
+
+        TEST_METHOD(DeserializeByElementErrorsTest)
+        {
+            const std::string duplicateIds{ R"({
+                "type": "AdaptiveCard",
+                "version": "1.0",
+                "body": [
+                    { "type": "Input.Text", "id": "duplicate" },
+                    { "type": "Input.Text", "id": "duplicate" }
+                ]
+            })"};
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeFromStringByElement(duplicateIds, "1.0"); });
+
+            // a syntax error inside an element is reported as found in the element, along with where the element is
+            const std::string malformed{ R"({
+                "type": "AdaptiveCard",
+                "version": "1.0",
+                "body": [
+                    { "type": "TextBlock", "text": "first" },
+                    { "type": "TextBlock" "text": "missing comma" }
+                ]
+            })"};
+
+            std::string message;
+            try
+            {
+                AdaptiveCard::DeserializeFromStringByElement(malformed, "1.0");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(e.GetStatusCode() == ErrorStatusCode::InvalidJson);
+                message = e.what();
+            }
+            Assert::AreEqual(0ui64, message.find("In body[1] (which starts at line 6, column 21 of the card): "));
+            Assert::AreNotEqual(std::string::npos, message.find("Line 1, Column 23"));
+
+            // as is one in a property of the card
+            const std::string malformedProperty{ R"({
+                "type": "AdaptiveCard",
+                "version": "1.0",
+                "selectAction": { "type": "Action.Submit" "id": "missing comma" },
+                "body": []
+            })"};
+
+            message.clear();
+            try
+            {
+                AdaptiveCard::DeserializeFromStringByElement(malformedProperty, "1.0");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                message = e.what();
+            }
+            Assert::AreEqual(0ui64, message.find("In selectAction (which starts at line 4, column 33 of the card): "));
+        }
     };
 }
@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "ParseUtil.h"
+#include "JsonWriter.h"
+#include "TextBlock.h"
 
 using namespace std::string_literals;
 
@@ -21,6 +23,15 @@ namespace AdaptiveCardsSharedModelUnitTest
             return jsonValue;
         }
 
+        // what ParseUtil::JsonToString wrote with before JsonWriter
+        static std::string s_WriteWithStreamWriter(const Json::Value& json)
+        {
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "";
+            return Json::writeString(builder, json) + "\n";
+        }
+
         static Json::Value s_GetValidJsonObject()
         {
             return s_GetJsonObject("{ \"foo\": \"bar\" }");
@@ -183,6 +194,25 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(arrayRet[1].asCString(), "thing2");
         }
 
+        TEST_METHOD(BorrowedLookupTests)
+        {
+            auto jsonObj = s_GetValidJsonObject();
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::ExtractJsonValueRef(jsonObj, AdaptiveCardSchemaKey::Accent, true); });
+            Assert::IsTrue(ParseUtil::ExtractJsonValueRef(jsonObj, AdaptiveCardSchemaKey::Accent).isNull());
+            Assert::IsTrue(ParseUtil::GetArrayRef(jsonObj, AdaptiveCardSchemaKey::Accent).isNull());
+
+            // the returned values refer into the parent rather than being copies of it
+            auto jsonObjWithAccentArray = s_GetJsonObjectWithAccent("[\"thing1\", \"thing2\"]"s);
+            const Json::Value& extracted = ParseUtil::ExtractJsonValueRef(jsonObjWithAccentArray, AdaptiveCardSchemaKey::Accent);
+            const Json::Value& arrayRet = ParseUtil::GetArrayRef(jsonObjWithAccentArray, AdaptiveCardSchemaKey::Accent, true);
+            Assert::IsTrue(&extracted == &jsonObjWithAccentArray["accent"]);
+            Assert::IsTrue(&arrayRet == &jsonObjWithAccentArray["accent"]);
+            Assert::AreEqual(arrayRet[1].asCString(), "thing2");
+
+            auto jsonObjWithAccentString = s_GetJsonObjectWithAccent("true"s);
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetArrayRef(jsonObjWithAccentString, AdaptiveCardSchemaKey::Accent); });
+        }
+
         TEST_METHOD(GetBoolTests)
         {
             auto jsonObj = s_GetValidJsonObject();
@@ -271,5 +301,67 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto actualString = ParseUtil::GetJsonString(jsonObjWithValidType, AdaptiveCardSchemaKey::Accent, true);
             Assert::AreEqual(actualString, "\"Valid\"\n"s);
         }
+
+        TEST_METHOD(JsonToStringMatchesStreamWriterTests)
+        {
+            Json::Value json(Json::objectValue);
+            json["escapes"] = "quote\" backslash\\ /\b\f\n\r\t\x01\x1f\x7f";
+            json["utf8"] = "caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80";
+            json["invalid utf8"] = "\xFF \xC0\xAF \xED\xA0\x80 \xC3";
+            json["numbers"].append(0);
+            json["numbers"].append(-2147483647 - 1);
+            json["numbers"].append(Json::Value::maxLargestInt);
+            json["numbers"].append(Json::Value::maxLargestUInt);
+            json["numbers"].append(0.1);
+            json["numbers"].append(-1.5e300);
+            json["B"] = true;
+            json["b"] = Json::Value::null;
+            json["ba"] = Json::Value(Json::objectValue);
+            json["empty"] = Json::Value(Json::arrayValue);
+            json["nested"]["z"]["a"] = false;
+
+            Assert::AreEqual(s_WriteWithStreamWriter(json), ParseUtil::JsonToString(json));
+            Assert::AreEqual(s_WriteWithStreamWriter(Json::Value("top level")), ParseUtil::JsonToString(Json::Value("top level")));
+        }
+
+        TEST_METHOD(JsonWriterTests)
+        {
+            JsonWriter writer;
+            writer.BeginObject();
+            writer.Property("b", 1);
+            writer.Property("ab", "second");
+            writer.Key("c");
+            writer.BeginArray();
+            writer.BeginObject();
+            writer.Property("y", true);
+            writer.Property("x", 2u);
+            writer.EndObject();
+            writer.Null();
+            writer.EndArray();
+            writer.Property("a", "first");
+            // the last value written for a name is kept, in its sorted place
+            writer.Property("b", "replaced");
+            writer.EndObject();
+            Assert::AreEqual(R"({"a":"first","ab":"second","b":"replaced","c":[{"x":2,"y":true},null]})"s, writer.GetString());
+
+            writer.Clear();
+            writer.BeginArray();
+            writer.String("\xE2\x82\xAC\"");
+            writer.Double(2.5);
+            writer.EndArray();
+            Assert::AreEqual(R"(["\u20ac\"",2.5])"s, writer.TakeString());
+            Assert::IsTrue(writer.GetString().empty());
+
+            // additional properties are written first, so the element's own properties win over any of the same name
+            TextBlock textBlock;
+            textBlock.SetText("text");
+            Json::Value additionalProperties;
+            additionalProperties["type"] = "NotATextBlock";
+            additionalProperties["text"] = "not the text";
+            additionalProperties["zzz"] = "\xC3\xA9";
+            textBlock.SetAdditionalProperties(additionalProperties);
+            Assert::AreEqual(s_WriteWithStreamWriter(textBlock.SerializeToJsonValue()), textBlock.Serialize());
+            Assert::AreEqual(R"({"text":"text","type":"TextBlock","zzz":"\u00e9"})"s + "\n", textBlock.Serialize());
+        }
     };
 }
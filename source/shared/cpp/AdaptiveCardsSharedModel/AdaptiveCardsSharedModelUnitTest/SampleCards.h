@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // the JSON of every card under samples/, which lives at the root of the repo
+    inline std::vector<std::string> LoadSampleCards()
+    {
+        const auto samplesPath = std::filesystem::path(__FILE__).parent_path() / ".." / ".." / ".." / ".." / ".." / "samples";
+
+        std::vector<std::string> cards;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(samplesPath))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ".json")
+            {
+                std::ifstream file(entry.path());
+                std::ostringstream contents;
+                contents << file.rdbuf();
+                cards.push_back(contents.str());
+            }
+        }
+        return cards;
+    }
+}
@@ -71,6 +71,20 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("0xF"); });
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("F"); });
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.c"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1..2"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version(".1"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.2.3.4.5"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("+1"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.2147483648"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.0\n"); });
+        }
+
+        TEST_METHOD(ComponentLimitTest)
+        {
+            // components are limited to what fits in an int, leading zeros don't count towards that
+            SemanticVersion version("2147483647.0000000000002147483647");
+            Assert::AreEqual(2147483647U, version.GetMajor());
+            Assert::AreEqual(2147483647U, version.GetMinor());
         }
 
         TEST_METHOD(CompareTest)
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include "Container.h"
+#include "JsonWriter.h"
+#include "ParseResult.h"
+#include "SampleCards.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace
+{
+    // a host's TextBlock that adds a property of its own to what it serializes
+    class TaggedTextBlock : public TextBlock
+    {
+    public:
+        Json::Value SerializeToJsonValue() const override
+        {
+            Json::Value root = TextBlock::SerializeToJsonValue();
+            root["tag"] = "tagged";
+            return root;
+        }
+    };
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(SerializationTest)
+    {
+    public:
+        TEST_METHOD(SerializeSamplesWithWriter)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "";
+
+            // the elements that write themselves must write what jsoncpp would write for SerializeToJsonValue
+            JsonWriter writer;
+            for (const auto& card : cards)
+            {
+                std::shared_ptr<AdaptiveCard> adaptiveCard;
+                try
+                {
+                    adaptiveCard = AdaptiveCard::DeserializeFromString(card, "1.6")->GetAdaptiveCard();
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    continue;
+                }
+
+                const std::string expected = Json::writeString(builder, adaptiveCard->SerializeToJsonValue());
+                writer.Clear();
+                adaptiveCard->SerializeTo(writer);
+                Assert::AreEqual(expected, writer.GetString());
+                Assert::AreEqual(expected + "\n", adaptiveCard->Serialize());
+
+                for (const auto& element : adaptiveCard->GetBody())
+                {
+                    Assert::AreEqual(Json::writeString(builder, element->SerializeToJsonValue()) + "\n", element->Serialize());
+                }
+            }
+        }
+
+        TEST_METHOD(DerivedElementsSerializeThroughSerializeToJsonValue)
+        {
+            auto textBlock = std::make_shared<TaggedTextBlock>();
+            textBlock->SetText("text");
+            Assert::AreEqual("{\"tag\":\"tagged\",\"text\":\"text\",\"type\":\"TextBlock\"}\n"s, textBlock->Serialize());
+
+            // and so does a card holding one, which otherwise writes its TextBlocks itself
+            auto container = std::make_shared<Container>();
+            container->GetItems().push_back(textBlock);
+            Assert::AreEqual(
+                "{\"items\":[{\"tag\":\"tagged\",\"text\":\"text\",\"type\":\"TextBlock\"}],\"type\":\"Container\"}\n"s,
+                container->Serialize());
+        }
+    };
+}
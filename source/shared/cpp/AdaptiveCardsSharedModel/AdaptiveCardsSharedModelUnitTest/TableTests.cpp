@@ -225,6 +225,33 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsFalse(context.warnings.empty(), L"Parsing a string with no units should yield warnings");
         }
 
+        TEST_METHOD(TableColumnDefinitionParsedWidth)
+        {
+            ParseContext context{};
+            auto weighted = TableColumnDefinition::DeserializeFromString(context, R"({ "width": 3 })");
+            Assert::IsTrue(ColumnWidthType::Weighted == weighted->GetParsedWidth().type);
+            Assert::AreEqual(3.0, weighted->GetParsedWidth().weight);
+
+            auto pixels = TableColumnDefinition::DeserializeFromString(context, R"({ "width": "100px" })");
+            Assert::IsTrue(ColumnWidthType::Pixels == pixels->GetParsedWidth().type);
+            Assert::AreEqual(100u, pixels->GetParsedWidth().pixels);
+
+            auto unset = TableColumnDefinition::DeserializeFromString(context, R"({ "width": "10" })");
+            Assert::IsTrue(ColumnWidthType::Stretch == unset->GetParsedWidth().type);
+            Assert::IsTrue(ColumnWidthType::Stretch == TableColumnDefinition().GetParsedWidth().type);
+
+            weighted->SetWidth(0);
+            Assert::IsTrue(ColumnWidthType::Auto == weighted->GetParsedWidth().type);
+            weighted->SetPixelWidth(40);
+            Assert::IsTrue(ColumnWidthType::Pixels == weighted->GetParsedWidth().type);
+
+            // a table's columns resolve the same way a ColumnSet's do
+            const auto widths = ColumnWidth::Resolve({pixels->GetParsedWidth(), unset->GetParsedWidth(), TableColumnDefinition::DeserializeFromString(context, R"({ "width": 3 })")->GetParsedWidth()}, 300);
+            Assert::AreEqual(100.0, widths[0]);
+            Assert::AreEqual(50.0, widths[1], 1e-9);
+            Assert::AreEqual(150.0, widths[2], 1e-9);
+        }
+
         TEST_METHOD(TableFragmentParseValid)
         {
             const std::string tableFragment = R"(
@@ -44,6 +44,71 @@ namespace AdaptiveCardsSharedModelUnitTest
             }
         }
 
+        TEST_METHOD(HtmlEncodingEdgesTest)
+        {
+            Assert::AreEqual("<>\"&"s, _GetTextBlockText("&lt;&gt;&quot;&amp;"));
+            Assert::AreEqual("a&"s, _GetTextBlockText("a&"));
+            Assert::AreEqual("&&<"s, _GetTextBlockText("&&&lt;"));
+            Assert::AreEqual("&amp &lt"s, _GetTextBlockText("&amp &lt"));
+            Assert::AreEqual("&AMP;"s, _GetTextBlockText("&AMP;"));
+            Assert::AreEqual("\xC2\xA0"s, _GetTextBlockText("&nbsp;"));
+        }
+
+        TEST_METHOD(MemoizedTextProcessingTest)
+        {
+            TextElementProperties::ResetMemoizationCounters();
+            TextBlock textBlock;
+            textBlock.SetText("Due {{DATE(2017-02-13T20:46:30Z)}} **soon**");
+
+            // nothing is kept while memoization is off, which it is by default
+            Assert::IsFalse(textBlock.IsTextMemoizationEnabled());
+            Assert::IsFalse(textBlock.GetTextForDateParsing() == textBlock.GetTextForDateParsing());
+            Assert::AreEqual<std::string>("<p>a <em>b</em></p>", textBlock.GetMarkDownResult("a *b*")->html);
+            Assert::AreEqual(0ull, TextElementProperties::GetMemoizationCounters().dateParsingMisses);
+            Assert::AreEqual(0ull, TextElementProperties::GetMemoizationCounters().markDownMisses);
+
+            // and things are kept only for elements it was turned on for
+            TextBlock otherTextBlock;
+            textBlock.SetTextMemoizationEnabled(true);
+            Assert::IsFalse(otherTextBlock.IsTextMemoizationEnabled());
+
+            // the text is split for date parsing once, and the same preparser handed out after that
+            const auto preparser = textBlock.GetTextForDateParsing();
+            Assert::IsTrue(preparser->HasDateTokens());
+            Assert::AreEqual<size_t>(3, preparser->GetTokens().size());
+            Assert::IsTrue(preparser == textBlock.GetTextForDateParsing());
+            const auto markDown = textBlock.GetMarkDownResult("Due 2/13/2017 **soon**");
+            Assert::AreEqual<std::string>("<p>Due 2/13/2017 <strong>soon</strong></p>", markDown->html);
+            Assert::IsTrue(markDown->hasHtmlTags);
+            Assert::IsTrue(markDown == textBlock.GetMarkDownResult("Due 2/13/2017 **soon**"));
+
+            auto counters = TextElementProperties::GetMemoizationCounters();
+            Assert::AreEqual(1ull, counters.dateParsingHits);
+            Assert::AreEqual(1ull, counters.dateParsingMisses);
+            Assert::AreEqual(1ull, counters.markDownHits);
+            Assert::AreEqual(1ull, counters.markDownMisses);
+
+            // text formatted for another locale is parsed again
+            Assert::AreEqual<std::string>("<p>Due 13.02.2017 <strong>soon</strong></p>",
+                                          textBlock.GetMarkDownResult("Due 13.02.2017 **soon**")->html);
+            Assert::AreEqual(2ull, TextElementProperties::GetMemoizationCounters().markDownMisses);
+
+            // setting the text or language drops what was kept
+            textBlock.SetText("no dates");
+            Assert::IsFalse(textBlock.GetTextForDateParsing()->HasDateTokens());
+            textBlock.SetLanguage("de");
+            textBlock.GetTextForDateParsing();
+            Assert::AreEqual(3ull, TextElementProperties::GetMemoizationCounters().dateParsingMisses);
+            Assert::IsFalse(markDown == textBlock.GetMarkDownResult("Due 2/13/2017 **soon**"));
+            Assert::AreEqual(3ull, TextElementProperties::GetMemoizationCounters().markDownMisses);
+
+            // what was handed out before stays as it was
+            Assert::AreEqual<size_t>(3, preparser->GetTokens().size());
+
+            TextElementProperties::ResetMemoizationCounters();
+            Assert::AreEqual(0ull, TextElementProperties::GetMemoizationCounters().dateParsingHits);
+        }
+
     private:
         std::string _GetTextBlockText(const std::string& testString)
         {
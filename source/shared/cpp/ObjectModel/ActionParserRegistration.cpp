@@ -12,6 +12,12 @@
 #include "ToggleVisibilityAction.h"
 #include "UnknownAction.h"
 
+namespace
+{
+// numbers the parsers registered with AddParser, for GetFingerprint
+std::atomic<unsigned long long> s_nextParserSerial{1};
+} // namespace
+
 namespace AdaptiveCards
 {
 ActionElementParserWrapper::ActionElementParserWrapper(std::shared_ptr<ActionElementParser> parserToWrap) :
@@ -35,7 +41,7 @@ std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ActionParserRegistration::ActionParserRegistration()
+ActionParserRegistration::ActionParserRegistration() : m_fingerprint(0)
 {
     m_knownElements.insert({
         ActionTypeToString(ActionType::Execute),
@@ -46,13 +52,18 @@ ActionParserRegistration::ActionParserRegistration()
         ActionTypeToString(ActionType::UnknownAction),
     });
 
-    m_cardElementParsers.insert(
-        {{ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
-         {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
-         {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
-         {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
-         {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
-         {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+    const std::pair<std::string, std::shared_ptr<ActionElementParser>> knownParsers[] = {
+        {ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
+        {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
+        {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
+        {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
+        {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
+        {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}};
+
+    for (const auto& knownParser : knownParsers)
+    {
+        _AddWrappedParser(knownParser.first, knownParser.second);
+    }
 }
 
 void ActionParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
@@ -60,7 +71,9 @@ void ActionParserRegistration::AddParser(std::string const& elementType, std::sh
     // make sure caller isn't attempting to overwrite a known element's parser
     if (m_knownElements.find(elementType) == m_knownElements.end())
     {
-        ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+        _AddWrappedParser(elementType, parser);
+        m_changedParsers[elementType] = s_nextParserSerial++;
+        _UpdateFingerprint();
     }
     else
     {
@@ -75,6 +88,8 @@ void ActionParserRegistration::RemoveParser(std::string const& elementType)
     if (m_knownElements.find(elementType) == m_knownElements.end())
     {
         ActionParserRegistration::m_cardElementParsers.erase(elementType);
+        m_changedParsers[elementType] = 0;
+        _UpdateFingerprint();
     }
     else
     {
@@ -83,22 +98,39 @@ void ActionParserRegistration::RemoveParser(std::string const& elementType)
     }
 }
 
-std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::string const& elementType) const
+const std::shared_ptr<ActionElementParser>& ActionParserRegistration::GetParser(std::string const& elementType) const
 {
     auto parser = m_cardElementParsers.find(elementType);
     if (parser != ActionParserRegistration::m_cardElementParsers.end())
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
-        // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
-        // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
-        // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-        std::shared_ptr<ActionElementParser> wrappedParser = std::make_shared<ActionElementParserWrapper>(parser->second);
-        return wrappedParser;
+        // mean having to explain all of this to custom element parser implementors. Instead, every parser we hand
+        // out is wrapped with a helper class that performs the push/pop on behalf of the element parser. The wrapper
+        // is built when the parser is registered (see _AddWrappedParser) rather than here, as this is called for
+        // every action we parse. For more details, refer to the giant comment on ID collision detection in
+        // ParseContext.cpp.
+        return parser->second;
     }
     else
     {
-        return std::shared_ptr<ActionElementParser>(nullptr);
+        static const std::shared_ptr<ActionElementParser> noParser;
+        return noParser;
+    }
+}
+
+void ActionParserRegistration::_AddWrappedParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
+{
+    m_cardElementParsers[elementType] = std::make_shared<ActionElementParserWrapper>(parser);
+}
+
+void ActionParserRegistration::_UpdateFingerprint()
+{
+    // summed, so that it doesn't depend on the order the changes are kept in
+    m_fingerprint = 0;
+    for (const auto& changedParser : m_changedParsers)
+    {
+        m_fingerprint += CaseInsensitiveHash{}(changedParser.first + '/' + std::to_string(changedParser.second));
     }
 }
 } // namespace AdaptiveCards
@@ -44,6 +44,11 @@ Json::Value ActionSet::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ActionSet::Clone() const
+{
+    return std::make_shared<ActionSet>(*this);
+}
+
 std::shared_ptr<BaseCardElement> ActionSetParser::Deserialize(ParseContext& context, const Json::Value& value)
 {
     ParseUtil::ExpectTypeString(value, CardElementType::ActionSet);
@@ -64,5 +69,7 @@ std::shared_ptr<BaseCardElement> ActionSetParser::DeserializeFromString(ParseCon
 
 void ActionSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::Actions});
+    m_knownProperties = &knownProperties;
 }
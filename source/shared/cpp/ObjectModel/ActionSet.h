@@ -18,6 +18,7 @@ public:
     ActionSet(std::vector<std::shared_ptr<BaseActionElement>>& actions);
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::vector<std::shared_ptr<BaseActionElement>>& GetActions();
     const std::vector<std::shared_ptr<BaseActionElement>>& GetActions() const;
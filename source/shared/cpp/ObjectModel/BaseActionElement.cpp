@@ -137,15 +137,52 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
     return root;
 }
 
+void BaseActionElement::WriteProperties(JsonWriter& writer) const
+{
+    BaseElement::WriteProperties(writer);
+
+    if (!m_iconUrl.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl), m_iconUrl);
+    }
+
+    if (!m_title.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title), m_title);
+    }
+
+    if (!m_style.empty() && (m_style.compare(defaultStyle) != 0))
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style), m_style);
+    }
+    if (m_mode != Mode::Primary)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode), ModeToString(m_mode));
+    }
+
+    if (!m_tooltip.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip), m_tooltip);
+    }
+
+    if (!m_isEnabled)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled), m_isEnabled);
+    }
+}
+
 void BaseActionElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::IconUrl,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::Title,
+             AdaptiveCardSchemaKey::Mode,
+             AdaptiveCardSchemaKey::Tooltip,
+             AdaptiveCardSchemaKey::IsEnabled});
+    m_knownProperties = &knownProperties;
 }
 
 void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -159,6 +196,11 @@ void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInforma
     }
 }
 
+std::shared_ptr<BaseElement> BaseActionElement::Clone() const
+{
+    return std::make_shared<BaseActionElement>(*this);
+}
+
 void BaseActionElement::ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& baseElement)
 {
     baseElement = ParseUtil::GetActionFromJsonValue(context, json);
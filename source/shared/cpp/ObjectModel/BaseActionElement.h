@@ -53,6 +53,7 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceUris) override;
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     template <typename T>
     static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& json);
@@ -62,6 +63,9 @@ public:
 
     static void ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element);
 
+protected:
+    void WriteProperties(JsonWriter& writer) const;
+
 private:
     void PopulateKnownPropertiesSet();
     static void DeserializeBaseProperties(ParseContext& context, const Json::Value& json, std::shared_ptr<BaseActionElement>& element);
@@ -87,7 +91,7 @@ std::shared_ptr<T> BaseActionElement::Deserialize(ParseContext& context, const J
     DeserializeBaseProperties(context, json, baseActionElement);
 
     // Walk all properties and put any unknown ones in the additional properties json
-    HandleUnknownProperties(json, baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
+    HandleUnknownProperties(json, *baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
 
     return cardElement;
 }
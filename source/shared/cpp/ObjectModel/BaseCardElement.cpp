@@ -27,12 +27,15 @@ BaseCardElement::BaseCardElement(CardElementType type) :
 
 void BaseCardElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Height,
+             AdaptiveCardSchemaKey::IsVisible,
+             AdaptiveCardSchemaKey::MinHeight,
+             AdaptiveCardSchemaKey::Separator,
+             AdaptiveCardSchemaKey::Spacing});
+    m_knownProperties = &knownProperties;
 }
 
 bool BaseCardElement::GetSeparator() const
@@ -107,6 +110,36 @@ Json::Value BaseCardElement::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> BaseCardElement::Clone() const
+{
+    return std::make_shared<BaseCardElement>(*this);
+}
+
+void BaseCardElement::WriteProperties(JsonWriter& writer) const
+{
+    BaseElement::WriteProperties(writer);
+
+    if (m_height != HeightType::Auto)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height), HeightTypeToString(GetHeight()));
+    }
+
+    if (m_spacing != Spacing::Default)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing), SpacingToString(m_spacing));
+    }
+
+    if (m_separator)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator), true);
+    }
+
+    if (!m_isVisible)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible), false);
+    }
+}
+
 Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseActionElement>& selectAction)
 {
     if (selectAction != nullptr)
@@ -119,11 +152,11 @@ Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseAct
 void BaseCardElement::ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element)
 {
     const std::string typeString = ParseUtil::GetTypeAsString(json);
-    std::shared_ptr<BaseCardElementParser> parser = context.elementParserRegistration->GetParser(typeString);
+    BaseCardElementParser* parser = context.elementParserRegistration->GetParser(typeString).get();
 
     if (parser == nullptr)
     {
-        parser = context.elementParserRegistration->GetParser("Unknown");
+        parser = context.elementParserRegistration->GetParser("Unknown").get();
     }
 
     auto parsedElement = parser->Deserialize(context, json);
@@ -27,6 +27,7 @@ public:
     ~BaseCardElement() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     virtual bool GetSeparator() const;
     virtual void SetSeparator(bool value);
@@ -52,6 +53,7 @@ public:
 
 protected:
     static Json::Value SerializeSelectAction(const std::shared_ptr<BaseActionElement>& selectAction);
+    void WriteProperties(JsonWriter& writer) const;
 
 private:
     void PopulateKnownPropertiesSet();
@@ -72,7 +74,7 @@ std::shared_ptr<T> BaseCardElement::Deserialize(ParseContext& context, const Jso
     DeserializeBaseProperties(context, json, baseCardElement);
 
     // Walk all properties and put any unknown ones in the additional properties json
-    HandleUnknownProperties(json, baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
+    HandleUnknownProperties(json, *baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
 
     return cardElement;
 }
@@ -6,27 +6,93 @@
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
 
+#include <mutex>
+
 namespace AdaptiveCards
 {
-unsigned int InternalId::s_currentInternalId = 1;
+// Internal IDs are handed out to threads in blocks so that cards can be parsed on several threads at once. Each
+// thread draws IDs from its own block without synchronization and only touches the shared counter to claim a new
+// block, so IDs stay unique across threads and the elements of a card get (mostly) consecutive IDs. When a thread
+// exits, whatever is left of its block is given back for the next thread that needs one, so threads that come and go
+// don't use up the counter (which would wrap around and start handing out IDs that are still in use).
+namespace
+{
+constexpr unsigned int c_internalIdBlockSize = 1024;
+std::atomic<unsigned int> s_nextInternalIdBlock{InternalId::Invalid + 1};
+
+// (first ID, count) of the unused parts of blocks given back by threads that exited
+std::mutex s_returnedInternalIdsMutex;
+std::vector<std::pair<unsigned int, unsigned int>> s_returnedInternalIds;
+std::atomic<bool> s_haveReturnedInternalIds{false};
+
+struct InternalIdBlock
+{
+    unsigned int current = InternalId::Invalid;
+    unsigned int left = 0;
+
+    ~InternalIdBlock()
+    {
+        if (left != 0)
+        {
+            std::lock_guard<std::mutex> lock(s_returnedInternalIdsMutex);
+            s_returnedInternalIds.emplace_back(current + 1, left);
+            s_haveReturnedInternalIds = true;
+        }
+    }
+
+    void Claim()
+    {
+        if (s_haveReturnedInternalIds)
+        {
+            std::lock_guard<std::mutex> lock(s_returnedInternalIdsMutex);
+            if (!s_returnedInternalIds.empty())
+            {
+                // the ID before the first one returned, as Next() moves on before handing out an ID
+                current = s_returnedInternalIds.back().first - 1;
+                left = s_returnedInternalIds.back().second;
+                s_returnedInternalIds.pop_back();
+                s_haveReturnedInternalIds = !s_returnedInternalIds.empty();
+                return;
+            }
+        }
+
+        current = s_nextInternalIdBlock.fetch_add(c_internalIdBlockSize, std::memory_order_relaxed) - 1;
+        left = c_internalIdBlockSize;
+    }
+};
+
+thread_local InternalIdBlock s_internalIdBlock;
+} // namespace
 
 InternalId InternalId::Current()
 {
-    InternalId internalId{s_currentInternalId};
+    if (s_internalIdBlock.current == InternalId::Invalid)
+    {
+        // nothing has been handed out on this thread yet
+        return Next();
+    }
+
+    InternalId internalId{s_internalIdBlock.current};
     return internalId;
 }
 
 InternalId InternalId::Next()
 {
-    s_currentInternalId++;
+    if (s_internalIdBlock.left == 0)
+    {
+        s_internalIdBlock.Claim();
+    }
+    s_internalIdBlock.current++;
+    s_internalIdBlock.left--;
 
-    // handle overflow case
-    if (s_currentInternalId == InternalId::Invalid)
+    // handle overflow case (only the block that wraps around can contain Invalid)
+    if (s_internalIdBlock.current == InternalId::Invalid)
     {
-        s_currentInternalId++;
+        return Next();
     }
 
-    return Current();
+    InternalId internalId{s_internalIdBlock.current};
+    return internalId;
 }
 
 InternalId::InternalId() : m_internalId{InternalId::Invalid}
@@ -39,7 +105,16 @@ InternalId::InternalId(const unsigned int id) : m_internalId{id}
 
 std::string BaseElement::Serialize() const
 {
-    return ParseUtil::JsonToString(SerializeToJsonValue());
+    JsonWriter writer;
+    SerializeTo(writer);
+    std::string json = writer.TakeString();
+    json += '\n';
+    return json;
+}
+
+void BaseElement::SerializeTo(JsonWriter& writer) const
+{
+    writer.Value(SerializeToJsonValue());
 }
 
 const std::string& BaseElement::GetId() const
@@ -72,11 +147,20 @@ void BaseElement::SetElementTypeString(const std::string& value)
 
 void BaseElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        {}, {AdaptiveCardSchemaKey::Fallback, AdaptiveCardSchemaKey::Id, AdaptiveCardSchemaKey::Requires, AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
+}
+
+std::unordered_set<std::string> BaseElement::ExtendKnownProperties(
+    const std::unordered_set<std::string>& baseProperties, std::initializer_list<AdaptiveCardSchemaKey> properties)
+{
+    std::unordered_set<std::string> knownProperties{baseProperties};
+    for (const auto property : properties)
+    {
+        knownProperties.insert(AdaptiveCardSchemaKeyToString(property));
+    }
+    return knownProperties;
 }
 
 const Json::Value& BaseElement::GetAdditionalProperties() const
@@ -101,21 +185,27 @@ bool BaseElement::MeetsRequirements(const AdaptiveCards::FeatureRegistration& fe
         // special case for adaptive cards version
         const auto& requirementName = requirement.first;
         const auto& requirementVersion = requirement.second;
-        const auto& featureVersion = featureRegistration.GetFeatureVersion(requirementName);
-        if (featureVersion.empty())
+        const SemanticVersion* providesVersion = featureRegistration.GetFeatureSemanticVersion(requirementName);
+        if (providesVersion != nullptr)
         {
-            // host doesn't provide this requirement
-            return false;
+            // host provides this requirement, but does it provide an acceptible version?
+            if (*providesVersion < requirementVersion)
+            {
+                // host's provided version is too low
+                return false;
+            }
         }
         else
         {
-            // host provides this requirement, but does it provide an acceptible version?
-            const SemanticVersion providesVersion{featureVersion};
-            if (providesVersion < requirementVersion)
+            const auto& featureVersion = featureRegistration.GetFeatureVersion(requirementName);
+            if (featureVersion.empty())
             {
-                // host's provided version is too low
+                // host doesn't provide this requirement
                 return false;
             }
+
+            // host registered this requirement as "*", which isn't a version we can compare against
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + featureVersion);
         }
     }
 
@@ -171,15 +261,54 @@ Json::Value BaseElement::SerializeToJsonValue() const
     return root;
 }
 
+void BaseElement::WriteProperties(JsonWriter& writer) const
+{
+    // written first, so that the known properties replace any of the same name as in SerializeToJsonValue
+    writer.Properties(m_additionalProperties);
+
+    writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type), GetElementTypeString());
+
+    if (!m_id.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id), m_id);
+    }
+
+    if (m_fallbackType == FallbackType::Drop)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback), "drop");
+    }
+    else if (m_fallbackType == FallbackType::Content)
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback));
+        m_fallbackContent->SerializeTo(writer);
+    }
+
+    if (!m_requires.empty())
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires));
+        writer.BeginObject();
+        for (const auto& requirement : m_requires)
+        {
+            writer.Property(requirement.first, static_cast<std::string>(requirement.second));
+        }
+        writer.EndObject();
+    }
+}
+
 // Base implementation for elements that have no resource information
 void BaseElement::GetResourceInformation(std::vector<RemoteResourceInformation>& /*resourceInfo*/)
 {
     return;
 }
 
+std::shared_ptr<BaseElement> BaseElement::Clone() const
+{
+    return std::make_shared<BaseElement>(*this);
+}
+
 void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& json)
 {
-    const auto requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
+    const auto& requiresValue = ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Requires, false);
     if (!requiresValue.isNull())
     {
         if (requiresValue.isObject())
@@ -5,12 +5,15 @@
 #include "pch.h"
 #include "json/json.h"
 #include "InternalId.h"
+#include "JsonWriter.h"
 #include "ParseContext.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
 #include "RemoteResourceInformation.h"
 #include "FeatureRegistration.h"
 
+#include <typeinfo>
+
 namespace AdaptiveCards
 {
 #ifdef _MSC_VER
@@ -18,11 +21,39 @@ class ParseContext;
 #endif
 class FeatureRegistration;
 
+// Whether an element or card is held by more than one parent, as the children of a clone are (see
+// BaseElement::Clone). Once set it stays set. A copy of what holds the flag starts out unshared, whatever the
+// original is, and the flag is set atomically, since clones of a const card may be made on several threads at once.
+class SharingFlag
+{
+public:
+    SharingFlag() = default;
+    SharingFlag(const SharingFlag&)
+    {
+    }
+    SharingFlag& operator=(const SharingFlag&)
+    {
+        return *this;
+    }
+
+    bool IsSet() const
+    {
+        return m_isSet.load();
+    }
+    void Set()
+    {
+        m_isSet.store(true);
+    }
+
+private:
+    std::atomic<bool> m_isSet{false};
+};
+
 class BaseElement
 {
 public:
     BaseElement() :
-        m_typeString{}, m_additionalProperties{}, m_requires{},
+        m_typeString{}, m_knownProperties(nullptr), m_additionalProperties{}, m_requires{},
         m_fallbackContent(nullptr), m_id{}, m_internalId{InternalId::Current()}, m_fallbackType(FallbackType::None),
         m_canFallbackToAncestor(false)
     {
@@ -54,6 +85,10 @@ public:
 
     virtual std::string Serialize() const;
     virtual Json::Value SerializeToJsonValue() const;
+    // Writes the same JSON as SerializeToJsonValue would give. By default it writes what SerializeToJsonValue
+    // returns; the common element types override it to write themselves without building a Json::Value. Classes
+    // derived from those are written from SerializeToJsonValue, as they may have changed what it returns.
+    virtual void SerializeTo(JsonWriter& writer) const;
     const Json::Value& GetAdditionalProperties() const;
     void SetAdditionalProperties(Json::Value&& additionalProperties);
     void SetAdditionalProperties(const Json::Value& additionalProperties);
@@ -88,6 +123,27 @@ public:
     // Misc.
     virtual void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceUris);
 
+    // A copy of this element that can be changed without changing this one. What the element owns outright (its
+    // text properties, facts, choices, inlines, media sources, background image and so on) is copied with it, but
+    // the elements and actions it holds (items, columns, rows, cells, images, select actions, fallback content, the
+    // card of a ShowCard) are shared with the original, so that a clone of a card only copies what is changed in it
+    // (see AdaptiveCard::GetElementForEdit). The copy keeps the internal id of the original, which it stands in for.
+    // Element types defined outside of this library get the Clone of the class they derive from (BaseCardElement or
+    // BaseActionElement, which copy what they hold as one of themselves); those that hold more override it.
+    virtual std::shared_ptr<BaseElement> Clone() const;
+
+    // Whether the element may be held by more than one parent, so that it has to be cloned before it's changed in
+    // one of them. AdaptiveCard::Clone and GetElementForEdit mark the children they share; code that puts an element
+    // into more than one card (or twice into one) by hand marks it itself.
+    bool IsShared() const
+    {
+        return m_sharing.IsSet();
+    }
+    void MarkShared()
+    {
+        m_sharing.Set();
+    }
+
 protected:
     void SetTypeString(std::string&& type)
     {
@@ -102,8 +158,34 @@ protected:
         m_canFallbackToAncestor = value;
     }
 
+    // Builds a type's known property set from its base type's set plus the properties the type adds. Each type
+    // does this once (see the PopulateKnownPropertiesSet implementations) and all of its instances share the result.
+    static std::unordered_set<std::string> ExtendKnownProperties(
+        const std::unordered_set<std::string>& baseProperties, std::initializer_list<AdaptiveCardSchemaKey> properties);
+
+    // For the Clone implementations: replaces each of objects with a copy of it
+    template <typename T>
+    static void CopyEach(std::vector<std::shared_ptr<T>>& objects)
+    {
+        for (auto& object : objects)
+        {
+            object = std::make_shared<T>(*object);
+        }
+    }
+
+    // Writes the properties BaseElement::SerializeToJsonValue serializes into the object being written, for the
+    // SerializeTo overrides. Each base class with properties of its own has one of these.
+    void WriteProperties(JsonWriter& writer) const;
+
+    // For the SerializeTo overrides: whether this is a T itself rather than an instance of a class derived from T
+    template <typename T>
+    bool IsExactly() const
+    {
+        return typeid(*this) == typeid(T);
+    }
+
     std::string m_typeString;
-    std::unordered_set<std::string> m_knownProperties;
+    const std::unordered_set<std::string>* m_knownProperties;
     Json::Value m_additionalProperties;
 
 private:
@@ -118,6 +200,7 @@ private:
     InternalId m_internalId;
     FallbackType m_fallbackType;
     bool m_canFallbackToAncestor;
+    SharingFlag m_sharing;
 };
 
 template <typename T>
@@ -135,7 +218,7 @@ void BaseElement::DeserializeBase(ParseContext& context, const Json::Value& json
 template <typename T>
 void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
 {
-    const auto fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+    const auto& fallbackValue = ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Fallback, false);
     if (!fallbackValue.empty())
     {
         // Two possible valid json values for fallback -- either the string "drop", or a valid Adaptive Card
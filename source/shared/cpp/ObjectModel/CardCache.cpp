@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardCache.h"
+#include "SharedAdaptiveCard.h"
+
+namespace
+{
+size_t CombineHash(size_t seed, size_t hash)
+{
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+CardCache::CardCache(size_t capacityInBytes) : m_capacityInBytes(capacityInBytes), m_sizeInBytes(0)
+{
+}
+
+std::shared_ptr<const FrozenCard> CardCache::DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion)
+{
+    // only its default registrations and settings are used, and never changed
+    static const ParseContext defaultContext;
+    return DeserializeFromString(jsonString, rendererVersion, defaultContext);
+}
+
+std::shared_ptr<const FrozenCard> CardCache::DeserializeFromString(
+    const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context)
+{
+    const ContextSettings settings{context.elementParserRegistration->GetFingerprint(),
+                                   context.actionParserRegistration->GetFingerprint(),
+                                   context.GetParentalContainerStyle(),
+                                   context.GetBleedDirection(),
+                                   context.GetCanFallbackToAncestor(),
+                                   context.GetBuildsElementIndex()};
+    Key key{0, jsonString, rendererVersion, context.GetLanguage(), settings};
+    key.hash = std::hash<std::string_view>{}(key.jsonString);
+    key.hash = CombineHash(key.hash, std::hash<std::string_view>{}(key.rendererVersion));
+    key.hash = CombineHash(key.hash, std::hash<std::string_view>{}(key.language));
+    key.hash = CombineHash(key.hash, settings.elementParserFingerprint);
+    key.hash = CombineHash(key.hash, settings.actionParserFingerprint);
+    key.hash = CombineHash(key.hash, static_cast<size_t>(settings.parentalContainerStyle));
+    key.hash = CombineHash(key.hash, static_cast<size_t>(settings.bleedDirection));
+    key.hash = CombineHash(key.hash, (settings.canFallbackToAncestor ? 1 : 0) | (settings.buildsElementIndex ? 2 : 0));
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto cached = _Find(key))
+        {
+            m_counters.hits++;
+            return cached;
+        }
+        m_counters.misses++;
+    }
+
+    // parsed and frozen without holding the lock, so a miss doesn't hold up other callers
+    ParseContext parseContext(context.elementParserRegistration, context.actionParserRegistration);
+    parseContext.SetLanguage(context.GetLanguage());
+    parseContext.SetParentalContainerStyle(settings.parentalContainerStyle);
+    parseContext.PushBleedDirection(settings.bleedDirection);
+    parseContext.SetCanFallbackToAncestor(settings.canFallbackToAncestor);
+    parseContext.SetBuildsElementIndex(settings.buildsElementIndex);
+    auto result = FrozenCard::Freeze(*AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, parseContext));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // another caller may have parsed the same card meanwhile; keep theirs, so that everyone shares one result
+    if (auto cached = _Find(key))
+    {
+        return cached;
+    }
+
+    const size_t entryBytes = jsonString.size();
+    if (entryBytes <= m_capacityInBytes)
+    {
+        while (m_sizeInBytes + entryBytes > m_capacityInBytes)
+        {
+            _EvictLeastRecentlyUsed();
+        }
+
+        m_entries.push_front({key.hash, jsonString, rendererVersion, context.GetLanguage(), settings, result});
+        m_entriesByHash.emplace(key.hash, m_entries.begin());
+        m_sizeInBytes += entryBytes;
+    }
+    return result;
+}
+
+size_t CardCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t CardCache::GetSizeInBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sizeInBytes;
+}
+
+CardCacheCounters CardCache::GetCounters() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_counters;
+}
+
+void CardCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entriesByHash.clear();
+    m_entries.clear();
+    m_sizeInBytes = 0;
+}
+
+std::shared_ptr<const FrozenCard> CardCache::_Find(const Key& key)
+{
+    auto sameHash = m_entriesByHash.equal_range(key.hash);
+    for (auto entry = sameHash.first; entry != sameHash.second; ++entry)
+    {
+        if (entry->second->Matches(key))
+        {
+            m_entries.splice(m_entries.begin(), m_entries, entry->second);
+            return entry->second->result;
+        }
+    }
+    return nullptr;
+}
+
+void CardCache::_EvictLeastRecentlyUsed()
+{
+    const auto& leastRecentlyUsed = m_entries.back();
+    auto sameHash = m_entriesByHash.equal_range(leastRecentlyUsed.hash);
+    for (auto entry = sameHash.first; entry != sameHash.second; ++entry)
+    {
+        if (&*entry->second == &leastRecentlyUsed)
+        {
+            m_entriesByHash.erase(entry);
+            break;
+        }
+    }
+    m_sizeInBytes -= leastRecentlyUsed.jsonString.size();
+    m_entries.pop_back();
+    m_counters.evictions++;
+}
+
+bool CardCache::ContextSettings::operator==(const ContextSettings& other) const
+{
+    return elementParserFingerprint == other.elementParserFingerprint &&
+           actionParserFingerprint == other.actionParserFingerprint &&
+           parentalContainerStyle == other.parentalContainerStyle && bleedDirection == other.bleedDirection &&
+           canFallbackToAncestor == other.canFallbackToAncestor && buildsElementIndex == other.buildsElementIndex;
+}
+
+bool CardCache::Entry::Matches(const Key& key) const
+{
+    return hash == key.hash && settings == key.settings && jsonString == key.jsonString &&
+           rendererVersion == key.rendererVersion && language == key.language;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "FrozenCard.h"
+#include "ParseContext.h"
+
+#include <list>
+#include <mutex>
+
+namespace AdaptiveCards
+{
+struct CardCacheCounters
+{
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+    unsigned long long evictions = 0;
+};
+
+// Keeps the results of parsing cards, so that the same card JSON parsed again returns the result of the first parse
+// instead of parsing it again. Results are keyed by the JSON text itself, the renderer version, the fingerprints of
+// the context's parser registrations and the rest of its settings that change what a parse gives (see
+// DeserializeFromString). Cards that fail to parse aren't kept: the exception is thrown to every caller.
+//
+// The cache is bounded by the bytes of card JSON it holds. A parsed card takes a few times the memory of its JSON,
+// so this bounds the memory of the cards too. Once keeping another card would take it over its capacity, the least
+// recently used ones are dropped to make room; a card whose JSON alone is larger than the capacity isn't kept.
+//
+// Every caller that parses the same card gets the same result, so results are handed out frozen (see FrozenCard).
+// A CardCache may be used from any number of threads at once.
+class CardCache
+{
+public:
+    explicit CardCache(size_t capacityInBytes);
+    CardCache(const CardCache&) = delete;
+    CardCache& operator=(const CardCache&) = delete;
+
+    // The cached result of AdaptiveCard::DeserializeFromString, or the result of calling it and freezing the card if
+    // there is none. The card is parsed with a context of its own that has the same parser registrations, language,
+    // element indexing, parental container style, bleed direction and fallback setting as context; the warnings of
+    // the parse go with the result, not into context.
+    std::shared_ptr<const FrozenCard> DeserializeFromString(
+        const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context);
+    std::shared_ptr<const FrozenCard> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
+
+    size_t GetCapacityInBytes() const
+    {
+        return m_capacityInBytes;
+    }
+    // how many results are cached, and the bytes of card JSON they were parsed from
+    size_t GetSize() const;
+    size_t GetSizeInBytes() const;
+    CardCacheCounters GetCounters() const;
+
+    // drops every cached result; the counters are kept
+    void Clear();
+
+private:
+    // the settings of a context, other than its language, that change what a parse gives
+    struct ContextSettings
+    {
+        size_t elementParserFingerprint;
+        size_t actionParserFingerprint;
+        ContainerStyle parentalContainerStyle;
+        ContainerBleedDirection bleedDirection;
+        bool canFallbackToAncestor;
+        bool buildsElementIndex;
+
+        bool operator==(const ContextSettings& other) const;
+    };
+
+    // what a cached result is looked up by, as views of the caller's strings
+    struct Key
+    {
+        size_t hash;
+        std::string_view jsonString;
+        std::string_view rendererVersion;
+        std::string_view language;
+        ContextSettings settings;
+    };
+
+    struct Entry
+    {
+        size_t hash;
+        std::string jsonString;
+        std::string rendererVersion;
+        std::string language;
+        ContextSettings settings;
+        std::shared_ptr<const FrozenCard> result;
+
+        bool Matches(const Key& key) const;
+    };
+
+    // the result cached for key, after marking it most recently used, or null if there is none; m_mutex must be held
+    std::shared_ptr<const FrozenCard> _Find(const Key& key);
+    // drops the least recently used entry; m_mutex must be held
+    void _EvictLeastRecentlyUsed();
+
+    const size_t m_capacityInBytes;
+    size_t m_sizeInBytes;
+    mutable std::mutex m_mutex;
+    // most recently used first
+    std::list<Entry> m_entries;
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> m_entriesByHash;
+    CardCacheCounters m_counters;
+};
+} // namespace AdaptiveCards
@@ -59,6 +59,13 @@ Json::Value ChoiceSetInput::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ChoiceSetInput::Clone() const
+{
+    auto clone = std::make_shared<ChoiceSetInput>(*this);
+    CopyEach(clone->m_choices);
+    return clone;
+}
+
 bool ChoiceSetInput::GetIsMultiSelect() const
 {
     return m_isMultiSelect;
@@ -143,11 +150,14 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::DeserializeFromString(Par
 
 void ChoiceSetInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Choices,
+             AdaptiveCardSchemaKey::IsMultiSelect,
+             AdaptiveCardSchemaKey::Placeholder,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::Value,
+             AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
@@ -22,6 +22,7 @@ public:
     ~ChoiceSetInput() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     bool GetIsMultiSelect() const;
     void SetIsMultiSelect(const bool isMultiSelect);
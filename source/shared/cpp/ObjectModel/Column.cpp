@@ -8,7 +8,7 @@
 
 using namespace AdaptiveCards;
 
-Column::Column() : StyledCollectionElement(CardElementType::Column), m_width("Auto"), m_pixelWidth(0)
+Column::Column() : StyledCollectionElement(CardElementType::Column), m_width("Auto"), m_pixelWidth(0), m_parsedWidth{}
 {
     PopulateKnownPropertiesSet();
 }
@@ -27,6 +27,7 @@ void Column::SetWidth(const std::string& value, std::vector<std::shared_ptr<Adap
 {
     m_width = ParseUtil::ToLowercase(value);
     m_pixelWidth = ParseSizeForPixelSize(m_width, warnings).value_or(0);
+    m_parsedWidth = ParseColumnWidth(m_width, m_pixelWidth);
 }
 
 // explicit width takes precedence over relative width
@@ -41,6 +42,12 @@ void Column::SetPixelWidth(const int value)
     std::ostringstream pixelString;
     pixelString << value << "px";
     m_width = pixelString.str();
+    m_parsedWidth = ParseColumnWidth(m_width, m_pixelWidth);
+}
+
+const ColumnWidth& Column::GetParsedWidth() const
+{
+    return m_parsedWidth;
 }
 
 const std::vector<std::shared_ptr<BaseCardElement>>& Column::GetItems() const
@@ -93,15 +100,56 @@ Json::Value Column::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> Column::Clone() const
+{
+    auto clone = std::make_shared<Column>(*this);
+    clone->CopyBackgroundImage();
+    return clone;
+}
+
+void Column::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<Column>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    StyledCollectionElement::WriteProperties(writer);
+
+    if (!m_width.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width), m_width);
+    }
+
+    writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items));
+    writer.BeginArray();
+    for (const auto& cardElement : m_items)
+    {
+        cardElement->SerializeTo(writer);
+    }
+    writer.EndArray();
+
+    if (m_rtl.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl), m_rtl.value_or(false));
+    }
+    writer.EndObject();
+}
+
 void Column::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Items,
+             AdaptiveCardSchemaKey::Rtl,
+             AdaptiveCardSchemaKey::SelectAction,
+             AdaptiveCardSchemaKey::Width,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::VerticalContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
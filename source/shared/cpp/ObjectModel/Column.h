@@ -6,6 +6,7 @@
 #include "Enums.h"
 #include "BackgroundImage.h"
 #include "BaseActionElement.h"
+#include "ColumnWidth.h"
 #include "StyledCollectionElement.h"
 
 namespace AdaptiveCards
@@ -19,6 +20,8 @@ public:
 
     std::string Serialize() const override;
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
+    void SerializeTo(JsonWriter& writer) const override;
 
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
@@ -30,6 +33,9 @@ public:
     int GetPixelWidth() const;
     void SetPixelWidth(const int value);
 
+    // the width as renderers should lay it out: "auto", and widths that aren't valid, are Auto
+    const ColumnWidth& GetParsedWidth() const;
+
     std::vector<std::shared_ptr<BaseCardElement>>& GetItems();
     const std::vector<std::shared_ptr<BaseCardElement>>& GetItems() const;
 
@@ -42,6 +48,7 @@ private:
     void PopulateKnownPropertiesSet();
     std::string m_width;
     unsigned int m_pixelWidth;
+    ColumnWidth m_parsedWidth;
     std::vector<std::shared_ptr<AdaptiveCards::BaseCardElement>> m_items;
     std::optional<bool> m_rtl;
 };
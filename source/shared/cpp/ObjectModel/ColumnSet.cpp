@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "ColumnSet.h"
 #include "Column.h"
+#include "ColumnWidth.h"
 #include "ParseUtil.h"
 #include "Image.h"
 #include "TextBlock.h"
@@ -25,6 +26,28 @@ std::vector<std::shared_ptr<Column>>& ColumnSet::GetColumns()
     return m_columns;
 }
 
+std::vector<double> ColumnSet::ResolveColumnWidths(double availableWidth, const std::vector<double>& autoColumnWidths) const
+{
+    std::vector<ColumnWidth> widths;
+    std::vector<double> measuredWidths(m_columns.size());
+    widths.reserve(m_columns.size());
+    for (size_t i = 0; i < m_columns.size(); i++)
+    {
+        if (m_columns[i]->GetIsVisible())
+        {
+            widths.push_back(m_columns[i]->GetParsedWidth());
+            measuredWidths[i] = (i < autoColumnWidths.size()) ? autoColumnWidths[i] : 0;
+        }
+        else
+        {
+            // an Auto column with nothing in it
+            widths.emplace_back();
+        }
+    }
+
+    return ColumnWidth::Resolve(widths, availableWidth, measuredWidths);
+}
+
 Json::Value ColumnSet::SerializeToJsonValue() const
 {
     Json::Value root = StyledCollectionElement::SerializeToJsonValue();
@@ -39,6 +62,34 @@ Json::Value ColumnSet::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ColumnSet::Clone() const
+{
+    auto clone = std::make_shared<ColumnSet>(*this);
+    clone->CopyBackgroundImage();
+    return clone;
+}
+
+void ColumnSet::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<ColumnSet>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    StyledCollectionElement::WriteProperties(writer);
+
+    writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns));
+    writer.BeginArray();
+    for (const auto& column : m_columns)
+    {
+        column->SerializeTo(writer);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
 void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& value)
 {
     m_columns = ParseUtil::GetElementCollection<Column>(
@@ -52,11 +103,14 @@ void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& va
 
 void ColumnSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Bleed,
+             AdaptiveCardSchemaKey::Columns,
+             AdaptiveCardSchemaKey::SelectAction,
+             AdaptiveCardSchemaKey::Style});
+    m_knownProperties = &knownProperties;
 }
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
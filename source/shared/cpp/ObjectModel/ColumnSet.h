@@ -22,11 +22,17 @@ public:
     ~ColumnSet() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
+    void SerializeTo(JsonWriter& writer) const override;
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
     std::vector<std::shared_ptr<Column>>& GetColumns();
     const std::vector<std::shared_ptr<Column>>& GetColumns() const;
 
+    // Each column's share of availableWidth, by ColumnWidth::Resolve. autoColumnWidths are the measured widths of
+    // the Auto columns, indexed like GetColumns(). Hidden columns get nothing.
+    std::vector<double> ResolveColumnWidths(double availableWidth, const std::vector<double>& autoColumnWidths = {}) const;
+
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
 private:
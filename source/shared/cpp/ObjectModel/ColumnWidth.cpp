@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ColumnWidth.h"
+#include "Util.h"
+
+using namespace AdaptiveCards;
+
+ColumnWidth AdaptiveCards::ParseColumnWidth(const std::string& width, unsigned int pixelWidth)
+{
+    if (pixelWidth != 0)
+    {
+        return {ColumnWidthType::Pixels, 0, pixelWidth};
+    }
+
+    if (width.empty() || width == "stretch")
+    {
+        return {ColumnWidthType::Stretch, 1, 0};
+    }
+
+    ParsedDimension weight;
+    if (ParseDimension(width, weight) == std::errc{} && weight.unit == ParsedDimension::Unit::Weight && weight.value > 0)
+    {
+        return {ColumnWidthType::Weighted, weight.value, 0};
+    }
+
+    return {};
+}
+
+std::vector<double> ColumnWidth::Resolve(
+    const std::vector<ColumnWidth>& widths, double availableWidth, const std::vector<double>& autoColumnWidths)
+{
+    std::vector<double> resolvedWidths(widths.size());
+    double remainingWidth = availableWidth;
+    double totalWeight = 0;
+
+    for (size_t i = 0; i < widths.size(); i++)
+    {
+        switch (widths[i].type)
+        {
+        case ColumnWidthType::Pixels:
+            resolvedWidths[i] = widths[i].pixels;
+            remainingWidth -= resolvedWidths[i];
+            break;
+        case ColumnWidthType::Auto:
+            resolvedWidths[i] = (i < autoColumnWidths.size()) ? autoColumnWidths[i] : 0;
+            remainingWidth -= resolvedWidths[i];
+            break;
+        case ColumnWidthType::Stretch:
+        case ColumnWidthType::Weighted:
+            totalWeight += widths[i].weight;
+            break;
+        }
+    }
+
+    if (remainingWidth > 0 && totalWeight > 0)
+    {
+        for (size_t i = 0; i < widths.size(); i++)
+        {
+            if (widths[i].type == ColumnWidthType::Stretch || widths[i].type == ColumnWidthType::Weighted)
+            {
+                resolvedWidths[i] = remainingWidth * widths[i].weight / totalWeight;
+            }
+        }
+    }
+
+    return resolvedWidths;
+}
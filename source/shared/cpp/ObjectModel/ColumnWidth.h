@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+
+namespace AdaptiveCards
+{
+// A column's width, worked out once from its "width" so renderers don't have to reparse the string
+struct ColumnWidth
+{
+    ColumnWidthType type{ColumnWidthType::Auto};
+    // relative size of a Stretch (always 1) or Weighted column
+    double weight{};
+    // size of a Pixels column
+    unsigned int pixels{};
+
+    // Splits availableWidth between columns the way a star-sized grid does. Pixels columns get their pixels and
+    // Auto columns get their entry in autoColumnWidths, the width their content measured at (0 if not given).
+    // Stretch and Weighted columns share whatever is left in proportion to their weights.
+    static std::vector<double> Resolve(
+        const std::vector<ColumnWidth>& widths, double availableWidth, const std::vector<double>& autoColumnWidths = {});
+};
+
+// A Column's width from its "width" and pixel width: "auto", and widths that aren't valid, are Auto
+ColumnWidth ParseColumnWidth(const std::string& width, unsigned int pixelWidth);
+} // namespace AdaptiveCards
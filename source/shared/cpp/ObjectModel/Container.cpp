@@ -59,6 +59,39 @@ Json::Value Container::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> Container::Clone() const
+{
+    auto clone = std::make_shared<Container>(*this);
+    clone->CopyBackgroundImage();
+    return clone;
+}
+
+void Container::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<Container>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    StyledCollectionElement::WriteProperties(writer);
+
+    writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items));
+    writer.BeginArray();
+    for (const auto& cardElement : m_items)
+    {
+        cardElement->SerializeTo(writer);
+    }
+    writer.EndArray();
+
+    if (m_rtl.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl), m_rtl.value_or(false));
+    }
+    writer.EndObject();
+}
+
 std::shared_ptr<BaseCardElement> ContainerParser::Deserialize(ParseContext& context, const Json::Value& value)
 {
     ParseUtil::ExpectTypeString(value, CardElementType::Container);
@@ -89,13 +122,16 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseCon
 
 void Container::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Bleed,
+             AdaptiveCardSchemaKey::Rtl,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::VerticalContentAlignment,
+             AdaptiveCardSchemaKey::SelectAction,
+             AdaptiveCardSchemaKey::Items});
+    m_knownProperties = &knownProperties;
 }
 
 void Container::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
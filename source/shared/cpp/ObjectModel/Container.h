@@ -23,6 +23,8 @@ public:
     ~Container() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
+    void SerializeTo(JsonWriter& writer) const override;
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
     std::vector<std::shared_ptr<BaseCardElement>>& GetItems();
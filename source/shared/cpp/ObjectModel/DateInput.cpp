@@ -39,6 +39,11 @@ Json::Value DateInput::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> DateInput::Clone() const
+{
+    return std::make_shared<DateInput>(*this);
+}
+
 std::string DateInput::GetMax() const
 {
     return m_max;
@@ -100,9 +105,12 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(ParseCon
 
 void DateInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Max,
+             AdaptiveCardSchemaKey::Min,
+             AdaptiveCardSchemaKey::Value,
+             AdaptiveCardSchemaKey::Placeholder});
+    m_knownProperties = &knownProperties;
 }
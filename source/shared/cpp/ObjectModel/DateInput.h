@@ -18,6 +18,7 @@ public:
     ~DateInput() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::string GetMax() const;
     void SetMax(const std::string& value);
@@ -26,27 +26,45 @@ DateTimePreparser::DateTimePreparser(std::string const& in) : m_hasDateTokens(fa
     ParseDateTime(in);
 }
 
-std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
+void DateTimePreparser::Parse(const std::string& in)
+{
+    m_textTokenCollection.clear();
+    m_hasDateTokens = false;
+    ParseDateTime(in);
+}
+
+const std::vector<DateTimePreparsedToken>& DateTimePreparser::GetTokens() const
 {
     return m_textTokenCollection;
 }
 
+std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
+{
+    std::vector<std::shared_ptr<DateTimePreparsedToken>> textTokens;
+    textTokens.reserve(m_textTokenCollection.size());
+    for (const auto& token : m_textTokenCollection)
+    {
+        textTokens.emplace_back(std::make_shared<DateTimePreparsedToken>(token));
+    }
+    return textTokens;
+}
+
 bool DateTimePreparser::HasDateTokens() const
 {
     return m_hasDateTokens;
 }
 
-void DateTimePreparser::AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddTextToken(std::string_view text, DateTimePreparsedTokenFormat format)
 {
     if (!text.empty())
     {
-        m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, format));
+        m_textTokenCollection.emplace_back(std::string{text}, format);
     }
 }
 
-void DateTimePreparser::AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddDateToken(std::string_view text, struct tm& date, DateTimePreparsedTokenFormat format)
 {
-    m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, date, format));
+    m_textTokenCollection.emplace_back(std::string{text}, date, format);
     m_hasDateTokens = true;
 }
 
@@ -55,7 +73,7 @@ std::string DateTimePreparser::Concatenate() const
     std::string formedString;
     for (const auto& piece : m_textTokenCollection)
     {
-        formedString += piece->GetText();
+        formedString += piece.GetText();
     }
     return formedString;
 }
@@ -103,194 +121,290 @@ constexpr time_t IntToTimeT(int timeToConvert)
 #pragma warning(pop)
 }
 
-void DateTimePreparser::ParseDateTime(const std::string& in)
+namespace
 {
-    if (in.find("{{") != std::string::npos)
+    // Reads exactly count decimal digits starting at pos, advancing pos past them
+    bool ReadDigits(std::string_view in, size_t& pos, size_t count, int& value)
     {
-        static const std::regex pattern(
-            "\\{\\{((DATE)|(TIME))\\((\\d{4})-{1}(\\d{2})-{1}(\\d{2})T(\\d{2}):{1}(\\d{2}):{1}(\\d{2})(Z|(([+-])(\\d{2}"
-            "):{1}(\\d{2})))((((, ?SHORT)|(, ?LONG))|(, ?COMPACT))|)\\)\\}\\}");
-        std::smatch matches;
-        std::string text = in;
-        enum MatchIndex
+        if (in.size() - pos < count)
         {
-            IsDate = 2,
-            Year = 4,
-            Month,
-            Day,
-            Hour,
-            Min,
-            Sec,
-            TimeZone = 12,
-            TZHr,
-            TZMn,
-            Format,
-            Style,
-        };
-        std::vector<int> indexer = {Year, Month, Day, Hour, Min, Sec, TZHr, TZMn};
+            return false;
+        }
 
-        while (std::regex_search(text, matches, pattern))
+        int result = 0;
+        for (size_t i = 0; i < count; i++)
         {
-            int formatStyle{};
-            // Date is matched
-            const bool isDate = matches[IsDate].matched;
-            int hours{}, minutes{};
-            struct tm parsedTm
+            const char c = in[pos + i];
+            if (c < '0' || c > '9')
             {
-            };
-            std::vector<int*> addrs = {
-                &parsedTm.tm_year, &parsedTm.tm_mon, &parsedTm.tm_mday, &parsedTm.tm_hour, &parsedTm.tm_min, &parsedTm.tm_sec, &hours, &minutes};
+                return false;
+            }
+            result = result * 10 + (c - '0');
+        }
+
+        value = result;
+        pos += count;
+        return true;
+    }
+
+    bool ReadChar(std::string_view in, size_t& pos, char expected)
+    {
+        if (pos < in.size() && in[pos] == expected)
+        {
+            pos++;
+            return true;
+        }
+        return false;
+    }
 
-            if (matches[Style].matched)
+    bool ReadWord(std::string_view in, size_t& pos, std::string_view expected)
+    {
+        if (in.substr(pos, expected.size()) == expected)
+        {
+            pos += expected.size();
+            return true;
+        }
+        return false;
+    }
+
+    struct DateTimeMacro
+    {
+        size_t length{};
+        bool isDate{};
+        int year{}, month{}, day{}, hour{}, minute{}, second{};
+        // '+' or '-' when there is an offset, 0 for Z
+        char timeZoneSign{};
+        int timeZoneHours{}, timeZoneMinutes{};
+        // 'S', 'L' or 'C' when a format was given
+        char formatStyle{};
+    };
+
+    // Matches {{DATE(YYYY-MM-DDThh:mm:ssZ[, SHORT|, LONG|, COMPACT])}} or the same with TIME at the start of in.
+    // The offset can be given as +hh:mm or -hh:mm instead of Z, and the space after the comma is optional.
+    bool TryMatchDateTimeMacro(std::string_view in, DateTimeMacro& macro)
+    {
+        size_t pos = 0;
+        if (!ReadWord(in, pos, "{{"))
+        {
+            return false;
+        }
+
+        if (ReadWord(in, pos, "DATE"))
+        {
+            macro.isDate = true;
+        }
+        else if (ReadWord(in, pos, "TIME"))
+        {
+            macro.isDate = false;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (!(ReadChar(in, pos, '(') && ReadDigits(in, pos, 4, macro.year) && ReadChar(in, pos, '-') &&
+              ReadDigits(in, pos, 2, macro.month) && ReadChar(in, pos, '-') && ReadDigits(in, pos, 2, macro.day) &&
+              ReadChar(in, pos, 'T') && ReadDigits(in, pos, 2, macro.hour) && ReadChar(in, pos, ':') &&
+              ReadDigits(in, pos, 2, macro.minute) && ReadChar(in, pos, ':') && ReadDigits(in, pos, 2, macro.second)))
+        {
+            return false;
+        }
+
+        macro.timeZoneSign = 0;
+        macro.timeZoneHours = 0;
+        macro.timeZoneMinutes = 0;
+        if (!ReadChar(in, pos, 'Z'))
+        {
+            if (pos >= in.size() || (in[pos] != '+' && in[pos] != '-'))
             {
-                // match for long/short/compact
-                bool formatHasSpace = matches[Format].str().at(1) == ' ';
-                const int formatStartIndex = formatHasSpace ? 2 : 1;
-                formatStyle = matches[Format].str().at(formatStartIndex);
+                return false;
             }
+            macro.timeZoneSign = in[pos++];
 
-            AddTextToken(matches.prefix().str(), DateTimePreparsedTokenFormat::RegularString);
-
-            if (!isDate && formatStyle)
+            if (!(ReadDigits(in, pos, 2, macro.timeZoneHours) && ReadChar(in, pos, ':') &&
+                  ReadDigits(in, pos, 2, macro.timeZoneMinutes)))
             {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
-                text = matches.suffix().str();
-                continue;
+                return false;
             }
+        }
 
-            for (unsigned int idx = 0; idx < indexer.size(); idx++)
+        macro.formatStyle = 0;
+        if (ReadChar(in, pos, ','))
+        {
+            ReadChar(in, pos, ' ');
+            static constexpr std::pair<std::string_view, char> formats[] = {{"SHORT", 'S'}, {"LONG", 'L'}, {"COMPACT", 'C'}};
+            for (const auto& format : formats)
             {
-                if (matches[indexer.at(idx)].matched)
+                if (ReadWord(in, pos, format.first))
                 {
-                    // get indexes for time attributes to index into corresponding matches
-                    // and convert it to string
-                    *(addrs.at(idx)) = stoi(matches[indexer.at(idx)]);
+                    macro.formatStyle = format.second;
+                    break;
                 }
             }
 
-            // check for date and time validation
-            if (IsValidTimeAndDate(parsedTm, hours, minutes))
+            if (!macro.formatStyle)
             {
-                time_t offset{};
-                // maches offset sign,
-                // Z == UTC,
-                // + == time added from UTC
-                // - == time subtracted from UTC
-                if (matches[TimeZone].matched)
-                {
-                    // converts to seconds
-                    hours *= 3600;
-                    minutes *= 60;
-                    offset = IntToTimeT(hours) + IntToTimeT(minutes);
-
-                    wchar_t zone = matches[TimeZone].str().at(0);
-                    // time zone offset calculation
-                    if (zone == '+')
-                    {
-                        offset *= -1;
-                    }
-                }
+                return false;
+            }
+        }
+
+        if (!ReadWord(in, pos, ")}}"))
+        {
+            return false;
+        }
+
+        macro.length = pos;
+        return true;
+    }
+}
 
-                // measured from year 1900
-                parsedTm.tm_year -= 1900;
-                parsedTm.tm_mon -= 1;
+void DateTimePreparser::ParseDateTime(const std::string& in)
+{
+    const std::string_view text{in};
+    size_t textStart = 0;
+    size_t macroStart = text.find("{{");
+    DateTimeMacro macro;
 
-                time_t utc{};
-                // converts to ticks in UTC
-                utc = mktime(&parsedTm);
-                if (utc == -1)
+    while (macroStart != std::string_view::npos)
+    {
+        if (!TryMatchDateTimeMacro(text.substr(macroStart), macro))
+        {
+            macroStart = text.find("{{", macroStart + 1);
+            continue;
+        }
+
+        const std::string_view match = text.substr(macroStart, macro.length);
+        const bool isDate = macro.isDate;
+        const int formatStyle = macro.formatStyle;
+        int hours = macro.timeZoneHours;
+        int minutes = macro.timeZoneMinutes;
+        struct tm parsedTm
+        {
+        };
+        parsedTm.tm_year = macro.year;
+        parsedTm.tm_mon = macro.month;
+        parsedTm.tm_mday = macro.day;
+        parsedTm.tm_hour = macro.hour;
+        parsedTm.tm_min = macro.minute;
+        parsedTm.tm_sec = macro.second;
+
+        AddTextToken(text.substr(textStart, macroStart - textStart), DateTimePreparsedTokenFormat::RegularString);
+        textStart = macroStart + macro.length;
+        macroStart = text.find("{{", textStart);
+
+        if (!isDate && formatStyle)
+        {
+            AddTextToken(match, DateTimePreparsedTokenFormat::RegularString);
+            continue;
+        }
+
+        // check for date and time validation
+        if (IsValidTimeAndDate(parsedTm, hours, minutes))
+        {
+            time_t offset{};
+            // maches offset sign,
+            // Z == UTC,
+            // + == time added from UTC
+            // - == time subtracted from UTC
+            if (macro.timeZoneSign)
+            {
+                // converts to seconds
+                hours *= 3600;
+                minutes *= 60;
+                offset = IntToTimeT(hours) + IntToTimeT(minutes);
+
+                // time zone offset calculation
+                if (macro.timeZoneSign == '+')
                 {
-                    AddTextToken(matches[0], DateTimePreparsedTokenFormat::RegularString);
+                    offset *= -1;
                 }
+            }
+
+            // measured from year 1900
+            parsedTm.tm_year -= 1900;
+            parsedTm.tm_mon -= 1;
+
+            time_t utc{};
+            // converts to ticks in UTC
+            utc = mktime(&parsedTm);
+            if (utc == -1)
+            {
+                AddTextToken(match, DateTimePreparsedTokenFormat::RegularString);
+            }
 
 // Disable "array to pointer decay" check for tzOffsetBuff since we can't change strftime's signature
 #pragma warning(push)
 #pragma warning(disable : 26485)
-                char tzOffsetBuff[6]{};
-                // gets local time zone offset
-                strftime(tzOffsetBuff, 6, "%z", &parsedTm);
-                std::string localTimeZoneOffsetStr(tzOffsetBuff);
-                const time_t nTzOffset = IntToTimeT(std::stoi(localTimeZoneOffsetStr));
-                offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
-                // add offset to utc
-                utc += offset;
-                struct tm result
-                {
-                };
+            char tzOffsetBuff[6]{};
+            // gets local time zone offset
+            strftime(tzOffsetBuff, 6, "%z", &parsedTm);
+            std::string localTimeZoneOffsetStr(tzOffsetBuff);
+            const time_t nTzOffset = IntToTimeT(std::stoi(localTimeZoneOffsetStr));
+            offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
+            // add offset to utc
+            utc += offset;
+            struct tm result
+            {
+            };
 #pragma warning(pop)
 
-                // converts to local time from utc
-                if (!LOCALTIME(&result, &utc))
+            // converts to local time from utc
+            if (!LOCALTIME(&result, &utc))
+            {
+                // localtime() set dst, put_time adjusts time accordingly which is not what we want since
+                // we have already taken cared of it in our calculation
+                if (result.tm_isdst == 1)
                 {
-                    // localtime() set dst, put_time adjusts time accordingly which is not what we want since
-                    // we have already taken cared of it in our calculation
-                    if (result.tm_isdst == 1)
-                    {
-                        result.tm_hour -= 1;
-                    }
+                    result.tm_hour -= 1;
+                }
 
-                    if (isDate)
-                    {
-                        switch (formatStyle)
-                        {
-                        // SHORT Style
-                        case 'S':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateShort);
-                            break;
-                        // LONG Style
-                        case 'L':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateLong);
-                            break;
-                        // COMPACT or DEFAULT Style
-                        case 'C':
-                        default:
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateCompact);
-                            break;
-                        }
-                    }
-                    else
+                if (isDate)
+                {
+                    switch (formatStyle)
                     {
-                        std::ostringstream parsedTime;
-                        parsedTime << std::put_time(&result, "%I:%M %p");
-                        AddTextToken(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString);
+                    // SHORT Style
+                    case 'S':
+                        AddDateToken(match, result, DateTimePreparsedTokenFormat::DateShort);
+                        break;
+                    // LONG Style
+                    case 'L':
+                        AddDateToken(match, result, DateTimePreparsedTokenFormat::DateLong);
+                        break;
+                    // COMPACT or DEFAULT Style
+                    case 'C':
+                    default:
+                        AddDateToken(match, result, DateTimePreparsedTokenFormat::DateCompact);
+                        break;
                     }
                 }
+                else
+                {
+                    std::ostringstream parsedTime;
+                    parsedTime << std::put_time(&result, "%I:%M %p");
+                    AddTextToken(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString);
+                }
             }
-            else
-            {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
-            }
-
-            text = matches.suffix().str();
         }
-
-        AddTextToken(text, DateTimePreparsedTokenFormat::RegularString);
-    }
-    else
-    {
-        AddTextToken(in, DateTimePreparsedTokenFormat::RegularString);
+        else
+        {
+            AddTextToken(match, DateTimePreparsedTokenFormat::RegularString);
+        }
     }
+
+    AddTextToken(text.substr(textStart), DateTimePreparsedTokenFormat::RegularString);
 }
 
 // Parses a time of the form HH:MM
 bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes)
 {
-    std::smatch subMatches;
-    static const std::regex timeMatch(R"regex(^(\d{2}):(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, timeMatch))
+    size_t pos = 0;
+    int parsedHours{}, parsedMinutes{};
+    if (ReadDigits(string, pos, 2, parsedHours) && ReadChar(string, pos, ':') && ReadDigits(string, pos, 2, parsedMinutes) &&
+        pos == string.size() && IsValidTime(parsedHours, parsedMinutes, 0))
     {
-        if (subMatches[1].matched && subMatches[2].matched)
-        {
-            unsigned int parsedHours = std::stoul(subMatches[1]);
-            unsigned int parsedMinutes = std::stoul(subMatches[2]);
-
-            if (IsValidTime(parsedHours, parsedMinutes, 0))
-            {
-                hours = parsedHours;
-                minutes = parsedMinutes;
-                return true;
-            }
-        }
+        hours = parsedHours;
+        minutes = parsedMinutes;
+        return true;
     }
     return false;
 }
@@ -298,24 +412,16 @@ bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned i
 // Parses a date of the form YYYY-MM-DD
 bool DateTimePreparser::TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day)
 {
-    std::smatch subMatches;
-    static const std::regex dateMatch(R"regex(^(\d{4})-(\d{2})-(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, dateMatch))
+    size_t pos = 0;
+    int parsedYear{}, parsedMonth{}, parsedDay{};
+    if (ReadDigits(string, pos, 4, parsedYear) && ReadChar(string, pos, '-') && ReadDigits(string, pos, 2, parsedMonth) &&
+        ReadChar(string, pos, '-') && ReadDigits(string, pos, 2, parsedDay) && pos == string.size() &&
+        IsValidDate(parsedYear, parsedMonth, parsedDay))
     {
-        if (subMatches[1].matched && subMatches[2].matched && subMatches[3].matched)
-        {
-            unsigned int parsedYear = std::stoul(subMatches[1]);
-            unsigned int parsedMonth = std::stoul(subMatches[2]);
-            unsigned int parsedDay = std::stoul(subMatches[3]);
-
-            if (IsValidDate(parsedYear, parsedMonth, parsedDay))
-            {
-                year = parsedYear;
-                month = parsedMonth;
-                day = parsedDay;
-                return true;
-            }
-        }
+        year = parsedYear;
+        month = parsedMonth;
+        day = parsedDay;
+        return true;
     }
     return false;
 }
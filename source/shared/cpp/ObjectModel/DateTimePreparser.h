@@ -12,21 +12,27 @@ class DateTimePreparser
 public:
     DateTimePreparser();
     DateTimePreparser(const std::string& in);
+
+    // Replaces the tokens with those of in. Reusing one preparser this way reuses its token buffer.
+    void Parse(const std::string& in);
+
+    const std::vector<DateTimePreparsedToken>& GetTokens() const;
+    // Same tokens as GetTokens, copied into newly allocated tokens.
     std::vector<std::shared_ptr<DateTimePreparsedToken>> GetTextTokens() const;
     bool HasDateTokens() const;
     static bool TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes);
     static bool TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day);
 
 private:
-    void AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format);
-    void AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format);
+    void AddTextToken(std::string_view text, DateTimePreparsedTokenFormat format);
+    void AddDateToken(std::string_view text, struct tm& date, DateTimePreparsedTokenFormat format);
     std::string Concatenate() const;
     void ParseDateTime(const std::string& in);
     static inline bool IsValidDate(const int year, const int month, const int day);
     static inline bool IsValidTime(const int hours, const int minutes, const int seconds);
     static inline bool IsValidTimeAndDate(const struct tm& parsedTm, const int hours, const int minutes);
 
-    std::vector<std::shared_ptr<DateTimePreparsedToken>> m_textTokenCollection;
+    std::vector<DateTimePreparsedToken> m_textTokenCollection;
     bool m_hasDateTokens;
 };
 } // namespace AdaptiveCards
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ElementIndex.h"
+#include "ElementTraversal.h"
+#include "ShowCardAction.h"
+
+namespace AdaptiveCards
+{
+namespace
+{
+std::shared_ptr<BaseElement> FindUnder(const BaseCardElement& element, const unsigned int* next, const unsigned int* end, std::vector<const BaseElement*>* path);
+std::shared_ptr<BaseElement> FindUnder(const BaseActionElement& action, const unsigned int* next, const unsigned int* end, std::vector<const BaseElement*>* path);
+
+// follows the position from next to end down from parent
+template <typename Parent>
+std::shared_ptr<BaseElement> FindChild(const Parent& parent, const unsigned int* next, const unsigned int* end, std::vector<const BaseElement*>* path)
+{
+    std::shared_ptr<BaseElement> found;
+    VisitChild(parent, *next, [&](const auto& child) {
+        if (path != nullptr)
+        {
+            path->push_back(child.get());
+        }
+        found = (next + 1 == end) ? child : FindUnder(*child, next + 1, end, path);
+    });
+    return found;
+}
+
+std::shared_ptr<BaseElement> FindUnder(const BaseCardElement& element, const unsigned int* next, const unsigned int* end, std::vector<const BaseElement*>* path)
+{
+    return FindChild(element, next, end, path);
+}
+
+std::shared_ptr<BaseElement> FindUnder(const BaseActionElement& action, const unsigned int* next, const unsigned int* end, std::vector<const BaseElement*>* path)
+{
+    if (action.GetElementType() == ActionType::ShowCard)
+    {
+        if (const auto card = static_cast<const ShowCardAction&>(action).GetCard())
+        {
+            return FindChild(*card, next, end, path);
+        }
+    }
+    return nullptr;
+}
+
+// looks for the element with the given id among what parent holds, and what that holds in turn
+template <typename Parent>
+void WalkChildren(Parent& parent, const std::string& id, std::vector<const BaseElement*>* path, std::shared_ptr<BaseElement>& found)
+{
+    VisitChildren(parent, [&](const auto& child) {
+        if (found != nullptr)
+        {
+            return;
+        }
+        if (path != nullptr)
+        {
+            path->push_back(child.get());
+        }
+        if (child->GetId() == id)
+        {
+            found = child;
+            return;
+        }
+        if constexpr (std::is_same_v<std::decay_t<decltype(*child)>, BaseActionElement>)
+        {
+            if (child->GetElementType() == ActionType::ShowCard)
+            {
+                if (const auto card = static_cast<const ShowCardAction&>(*child).GetCard())
+                {
+                    WalkChildren(*card, id, path, found);
+                }
+            }
+        }
+        else
+        {
+            WalkChildren(*child, id, path, found);
+        }
+        if (found == nullptr && path != nullptr)
+        {
+            path->pop_back();
+        }
+    });
+}
+} // namespace
+
+ElementIndex::ElementIndex(const AdaptiveCard& card)
+{
+    std::vector<unsigned int> position;
+    _AddChildren(card, position);
+}
+
+std::shared_ptr<BaseElement> ElementIndex::FindByWalking(const AdaptiveCard& card, const std::string& id, std::vector<const BaseElement*>* path)
+{
+    std::shared_ptr<BaseElement> found;
+    if (!id.empty())
+    {
+        // VisitChildren lets visit replace children, which this doesn't do, so it can be given the const card
+        WalkChildren(const_cast<AdaptiveCard&>(card), id, path, found);
+    }
+    return found;
+}
+
+std::shared_ptr<BaseElement> ElementIndex::Find(const AdaptiveCard& card, const std::string& id, std::vector<const BaseElement*>* path) const
+{
+    const auto entry = m_positions.find(id);
+    if (entry == m_positions.end())
+    {
+        return nullptr;
+    }
+
+    const auto& position = entry->second;
+    const auto element = FindChild(card, position.data(), position.data() + position.size(), path);
+    if (element == nullptr || element->GetId() != id)
+    {
+        if (path != nullptr)
+        {
+            path->clear();
+        }
+        return nullptr;
+    }
+    return element;
+}
+
+void ElementIndex::_AddChildren(const AdaptiveCard& card, std::vector<unsigned int>& position)
+{
+    // VisitChildren lets visit replace children, which this doesn't do, so it can be given the const card
+    unsigned int index = 0;
+    VisitChildren(const_cast<AdaptiveCard&>(card), [&](const auto& child) {
+        position.push_back(index++);
+        _Add(*child, position);
+        position.pop_back();
+    });
+}
+
+void ElementIndex::_Add(const BaseCardElement& element, std::vector<unsigned int>& position)
+{
+    if (!element.GetId().empty())
+    {
+        m_positions.emplace(element.GetId(), position);
+    }
+
+    unsigned int index = 0;
+    VisitChildren(const_cast<BaseCardElement&>(element), [&](const auto& child) {
+        position.push_back(index++);
+        _Add(*child, position);
+        position.pop_back();
+    });
+}
+
+void ElementIndex::_Add(const BaseActionElement& action, std::vector<unsigned int>& position)
+{
+    if (!action.GetId().empty())
+    {
+        m_positions.emplace(action.GetId(), position);
+    }
+
+    if (action.GetElementType() == ActionType::ShowCard)
+    {
+        if (const auto card = static_cast<const ShowCardAction&>(action).GetCard())
+        {
+            _AddChildren(*card, position);
+        }
+    }
+}
+} // namespace AdaptiveCards
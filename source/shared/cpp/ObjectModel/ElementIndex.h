@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "BaseElement.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class BaseActionElement;
+class BaseCardElement;
+
+// Where each element and action with an id is in a card, so that AdaptiveCard::GetElementById can go straight to it
+// rather than walk the card. An element is kept as its position: the index of each child (in the order VisitChildren
+// visits them, going into the cards of ShowCard actions) on the way down to it. Nothing in the card tells the index
+// when the card changes, so Find checks that what it finds at a position still has the id it was indexed under; when
+// it doesn't, FindByWalking tells whether the element is still in the card somewhere else. Fallback content isn't
+// indexed; where the card repeats an id, the first element with it, in document order, is.
+class ElementIndex
+{
+public:
+    explicit ElementIndex(const AdaptiveCard& card);
+
+    // The element or action that had the given id when card was indexed, if it is still where it was and still has
+    // the id; null otherwise. If path is given, it receives the elements and actions on the way down to it,
+    // including it but not counting the cards of ShowCard actions.
+    std::shared_ptr<BaseElement> Find(const AdaptiveCard& card, const std::string& id, std::vector<const BaseElement*>* path = nullptr) const;
+
+    // The first element or action in card with the given id, found by walking the card in the order the index is
+    // built in, or null if there is none. path is filled in as by Find.
+    static std::shared_ptr<BaseElement> FindByWalking(const AdaptiveCard& card, const std::string& id, std::vector<const BaseElement*>* path = nullptr);
+
+    size_t GetSize() const
+    {
+        return m_positions.size();
+    }
+
+private:
+    void _AddChildren(const AdaptiveCard& card, std::vector<unsigned int>& position);
+    void _Add(const BaseCardElement& element, std::vector<unsigned int>& position);
+    void _Add(const BaseActionElement& action, std::vector<unsigned int>& position);
+
+    std::unordered_map<std::string, std::vector<unsigned int>> m_positions;
+};
+
+// Holds the ElementIndex of a card. A lookup on a const card may replace an index that has gone stale, so the index
+// is loaded and stored atomically, copies of the card included.
+class ElementIndexHolder
+{
+public:
+    ElementIndexHolder() = default;
+    ElementIndexHolder(const ElementIndexHolder& other) : m_index(other.Load())
+    {
+    }
+    ElementIndexHolder& operator=(const ElementIndexHolder& other)
+    {
+        Store(other.Load());
+        return *this;
+    }
+
+    std::shared_ptr<const ElementIndex> Load() const
+    {
+        return std::atomic_load(&m_index);
+    }
+    void Store(std::shared_ptr<const ElementIndex> index)
+    {
+        std::atomic_store(&m_index, std::move(index));
+    }
+
+private:
+    std::shared_ptr<const ElementIndex> m_index;
+};
+} // namespace AdaptiveCards
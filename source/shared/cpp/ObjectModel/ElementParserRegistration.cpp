@@ -21,6 +21,12 @@
 #include "ToggleInput.h"
 #include "UnknownElement.h"
 
+namespace
+{
+// numbers the parsers registered with AddParser, for GetFingerprint
+std::atomic<unsigned long long> s_nextParserSerial{1};
+} // namespace
+
 namespace AdaptiveCards
 {
 BaseCardElementParserWrapper::BaseCardElementParserWrapper(std::shared_ptr<BaseCardElementParser> parserToWrap) :
@@ -45,7 +51,7 @@ std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ElementParserRegistration::ElementParserRegistration()
+ElementParserRegistration::ElementParserRegistration() : m_fingerprint(0)
 {
     m_knownElements.insert(
         {CardElementTypeToString(CardElementType::ActionSet),
@@ -67,32 +73,39 @@ ElementParserRegistration::ElementParserRegistration()
          CardElementTypeToString(CardElementType::ToggleInput),
          CardElementTypeToString(CardElementType::Unknown)});
 
-    m_cardElementParsers.insert(
-        {{CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
-         {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
-         {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
-         {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
-         {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
-         {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
-         {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
-         {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
-         {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
-         {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
-         {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
-         {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
-         {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
-         {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
-         {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
-         {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
-         {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
-         {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+    const std::pair<std::string, std::shared_ptr<BaseCardElementParser>> knownParsers[] = {
+        {CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
+        {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
+        {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
+        {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
+        {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
+        {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
+        {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
+        {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
+        {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
+        {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
+        {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
+        {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
+        {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
+        {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
+        {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
+        {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
+        {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
+        {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}};
+
+    for (const auto& knownParser : knownParsers)
+    {
+        _AddWrappedParser(knownParser.first, knownParser.second);
+    }
 }
 
 void ElementParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
 {
     if (m_knownElements.find(elementType) == m_knownElements.end())
     {
-        ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+        _AddWrappedParser(elementType, parser);
+        m_changedParsers[elementType] = s_nextParserSerial++;
+        _UpdateFingerprint();
     }
     else
     {
@@ -106,6 +119,8 @@ void ElementParserRegistration::RemoveParser(std::string const& elementType)
     if (m_knownElements.find(elementType) == m_knownElements.end())
     {
         ElementParserRegistration::m_cardElementParsers.erase(elementType);
+        m_changedParsers[elementType] = 0;
+        _UpdateFingerprint();
     }
     else
     {
@@ -114,22 +129,39 @@ void ElementParserRegistration::RemoveParser(std::string const& elementType)
     }
 }
 
-std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std::string const& elementType) const
+const std::shared_ptr<BaseCardElementParser>& ElementParserRegistration::GetParser(std::string const& elementType) const
 {
     auto parser = m_cardElementParsers.find(elementType);
     if (parser != ElementParserRegistration::m_cardElementParsers.end())
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
-        // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
-        // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
-        // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-        std::shared_ptr<BaseCardElementParser> wrappedParser = std::make_shared<BaseCardElementParserWrapper>(parser->second);
-        return wrappedParser;
+        // mean having to explain all of this to custom element parser implementors. Instead, every parser we hand
+        // out is wrapped with a helper class that performs the push/pop on behalf of the element parser. The wrapper
+        // is built when the parser is registered (see _AddWrappedParser) rather than here, as this is called for
+        // every element we parse. For more details, refer to the giant comment on ID collision detection in
+        // ParseContext.cpp.
+        return parser->second;
     }
     else
     {
-        return std::shared_ptr<BaseCardElementParser>(nullptr);
+        static const std::shared_ptr<BaseCardElementParser> noParser;
+        return noParser;
+    }
+}
+
+void ElementParserRegistration::_AddWrappedParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
+{
+    m_cardElementParsers[elementType] = std::make_shared<BaseCardElementParserWrapper>(parser);
+}
+
+void ElementParserRegistration::_UpdateFingerprint()
+{
+    // summed, so that it doesn't depend on the order the changes are kept in
+    m_fingerprint = 0;
+    for (const auto& changedParser : m_changedParsers)
+    {
+        m_fingerprint += CaseInsensitiveHash{}(changedParser.first + '/' + std::to_string(changedParser.second));
     }
 }
 } // namespace AdaptiveCards
@@ -46,10 +46,31 @@ public:
 
     void AddParser(std::string const& elementType, std::shared_ptr<AdaptiveCards::BaseCardElementParser> parser);
     void RemoveParser(std::string const& elementType);
-    std::shared_ptr<AdaptiveCards::BaseCardElementParser> GetParser(std::string const& elementType) const;
+    // The parser registered for elementType, or null. The reference stays valid until the parser is removed or
+    // replaced; it's handed out by reference as this is called for every element parsed.
+    const std::shared_ptr<AdaptiveCards::BaseCardElementParser>& GetParser(std::string const& elementType) const;
+
+    // Tells registrations apart by the parsers added and removed since they were constructed: registrations that
+    // haven't been changed share a fingerprint, and any AddParser or RemoveParser call gives a new one. Used to
+    // key cached cards (see CardCache) by the parsers they were parsed with.
+    size_t GetFingerprint() const
+    {
+        return m_fingerprint;
+    }
 
 private:
+    void _AddWrappedParser(std::string const& elementType, std::shared_ptr<AdaptiveCards::BaseCardElementParser> parser);
+    void _UpdateFingerprint();
+
     std::unordered_set<std::string> m_knownElements;
+
+    // Parsers are wrapped once, when they're registered, so GetParser can hand out the same wrapper every time.
+    // The wrappers are kept as the type GetParser returns, so it can return a reference to them.
     std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+
+    // for each type added or removed since construction, a number unique to the AddParser call that added it, or 0
+    // if it was removed
+    std::unordered_map<std::string, unsigned long long, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_changedParsers;
+    size_t m_fingerprint;
 };
 } // namespace AdaptiveCards
@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableRow.h"
+#include "TextInput.h"
+#include "TextRun.h"
+
+namespace AdaptiveCards
+{
+namespace ElementTraversal
+{
+// Calls visit with the select action of element, if it has one, and gives element whatever visit left in its place.
+// getter and setter are the element's accessors for the action.
+template <typename T, typename Visitor>
+void VisitAction(T& element, std::shared_ptr<BaseActionElement> (T::*getter)() const, void (T::*setter)(const std::shared_ptr<BaseActionElement>), Visitor& visit)
+{
+    if (auto action = (element.*getter)())
+    {
+        const auto original = action;
+        visit(action);
+        if (action != original)
+        {
+            (element.*setter)(action);
+        }
+    }
+}
+
+template <typename T, typename Visitor>
+void VisitEach(std::vector<std::shared_ptr<T>>& children, Visitor& visit)
+{
+    for (auto& child : children)
+    {
+        visit(child);
+    }
+}
+
+// For VisitChild: calls visit with the child at index, if there is one. If not, takes the children off index.
+template <typename T, typename Visitor>
+bool VisitAt(const std::vector<std::shared_ptr<T>>& children, size_t& index, Visitor& visit)
+{
+    if (index < children.size())
+    {
+        visit(children[index]);
+        return true;
+    }
+    index -= children.size();
+    return false;
+}
+
+template <typename Visitor>
+bool VisitActionAt(const std::shared_ptr<BaseActionElement>& action, size_t& index, Visitor& visit)
+{
+    if (action == nullptr)
+    {
+        return false;
+    }
+    if (index == 0)
+    {
+        visit(action);
+        return true;
+    }
+    index--;
+    return false;
+}
+} // namespace ElementTraversal
+
+// Calls visit for each element and action that element holds directly, in the order they appear in the card: the
+// items of a Container, Column or TableCell, the columns of a ColumnSet, the rows of a Table and the cells of a
+// TableRow, the images of an ImageSet, the actions of an ActionSet, and select and inline actions (including those
+// of the TextRuns of a RichTextBlock). visit is passed the std::shared_ptr that holds the child, as a
+// std::shared_ptr<BaseCardElement>&, <Column>&, <Image>&, <TableRow>&, <TableCell>& or <BaseActionElement>&, and may
+// replace it. Fallback content isn't visited, nor are the children of custom and unknown elements.
+template <typename Visitor>
+void VisitChildren(BaseCardElement& element, Visitor&& visit)
+{
+    using namespace ElementTraversal;
+    switch (element.GetElementType())
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+    {
+        auto& container = static_cast<Container&>(element);
+        VisitEach(container.GetItems(), visit);
+        VisitAction<StyledCollectionElement>(container, &StyledCollectionElement::GetSelectAction, &StyledCollectionElement::SetSelectAction, visit);
+        break;
+    }
+    case CardElementType::Column:
+    {
+        auto& column = static_cast<Column&>(element);
+        VisitEach(column.GetItems(), visit);
+        VisitAction<StyledCollectionElement>(column, &StyledCollectionElement::GetSelectAction, &StyledCollectionElement::SetSelectAction, visit);
+        break;
+    }
+    case CardElementType::ColumnSet:
+    {
+        auto& columnSet = static_cast<ColumnSet&>(element);
+        VisitEach(columnSet.GetColumns(), visit);
+        VisitAction<StyledCollectionElement>(columnSet, &StyledCollectionElement::GetSelectAction, &StyledCollectionElement::SetSelectAction, visit);
+        break;
+    }
+    case CardElementType::Table:
+        VisitEach(static_cast<Table&>(element).GetRows(), visit);
+        break;
+    case CardElementType::TableRow:
+        VisitEach(static_cast<TableRow&>(element).GetCells(), visit);
+        break;
+    case CardElementType::ActionSet:
+        VisitEach(static_cast<ActionSet&>(element).GetActions(), visit);
+        break;
+    case CardElementType::ImageSet:
+        VisitEach(static_cast<ImageSet&>(element).GetImages(), visit);
+        break;
+    case CardElementType::Image:
+        VisitAction(static_cast<Image&>(element), &Image::GetSelectAction, &Image::SetSelectAction, visit);
+        break;
+    case CardElementType::RichTextBlock:
+        for (const auto& inlineElement : static_cast<RichTextBlock&>(element).GetInlines())
+        {
+            if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+            {
+                VisitAction(static_cast<TextRun&>(*inlineElement), &TextRun::GetSelectAction, &TextRun::SetSelectAction, visit);
+            }
+        }
+        break;
+    case CardElementType::TextInput:
+        VisitAction(static_cast<TextInput&>(element), &TextInput::GetInlineAction, &TextInput::SetInlineAction, visit);
+        break;
+    default:
+        break;
+    }
+}
+
+// Calls visit for the select action, body and actions of card, as VisitChildren does for an element. The card of a
+// ShowCard action isn't one of the action's children; callers that go into it do so themselves.
+template <typename Visitor>
+void VisitChildren(AdaptiveCard& card, Visitor&& visit)
+{
+    using namespace ElementTraversal;
+    VisitAction(card, &AdaptiveCard::GetSelectAction, &AdaptiveCard::SetSelectAction, visit);
+    VisitEach(card.GetBody(), visit);
+    VisitEach(card.GetActions(), visit);
+}
+// Calls visit for the child that VisitChildren would visit after index others, if there is one, and returns whether
+// there was. It goes straight to the child, so a child's position can stand in for it (see ElementIndex). visit is
+// passed a const std::shared_ptr& to the child and can't replace it.
+template <typename Visitor>
+bool VisitChild(const BaseCardElement& element, size_t index, Visitor&& visit)
+{
+    using namespace ElementTraversal;
+    switch (element.GetElementType())
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+    {
+        const auto& container = static_cast<const Container&>(element);
+        return VisitAt(container.GetItems(), index, visit) || VisitActionAt(container.GetSelectAction(), index, visit);
+    }
+    case CardElementType::Column:
+    {
+        const auto& column = static_cast<const Column&>(element);
+        return VisitAt(column.GetItems(), index, visit) || VisitActionAt(column.GetSelectAction(), index, visit);
+    }
+    case CardElementType::ColumnSet:
+    {
+        const auto& columnSet = static_cast<const ColumnSet&>(element);
+        return VisitAt(columnSet.GetColumns(), index, visit) || VisitActionAt(columnSet.GetSelectAction(), index, visit);
+    }
+    case CardElementType::Table:
+        return VisitAt(static_cast<const Table&>(element).GetRows(), index, visit);
+    case CardElementType::TableRow:
+        return VisitAt(static_cast<const TableRow&>(element).GetCells(), index, visit);
+    case CardElementType::ActionSet:
+        return VisitAt(static_cast<const ActionSet&>(element).GetActions(), index, visit);
+    case CardElementType::ImageSet:
+        return VisitAt(static_cast<const ImageSet&>(element).GetImages(), index, visit);
+    case CardElementType::Image:
+        return VisitActionAt(static_cast<const Image&>(element).GetSelectAction(), index, visit);
+    case CardElementType::RichTextBlock:
+        for (const auto& inlineElement : static_cast<const RichTextBlock&>(element).GetInlines())
+        {
+            if (inlineElement->GetInlineType() == InlineElementType::TextRun &&
+                VisitActionAt(static_cast<const TextRun&>(*inlineElement).GetSelectAction(), index, visit))
+            {
+                return true;
+            }
+        }
+        return false;
+    case CardElementType::TextInput:
+        return VisitActionAt(static_cast<const TextInput&>(element).GetInlineAction(), index, visit);
+    default:
+        return false;
+    }
+}
+
+template <typename Visitor>
+bool VisitChild(const AdaptiveCard& card, size_t index, Visitor&& visit)
+{
+    using namespace ElementTraversal;
+    return VisitActionAt(card.GetSelectAction(), index, visit) || VisitAt(card.GetBody(), index, visit) ||
+        VisitAt(card.GetActions(), index, visit);
+}
+} // namespace AdaptiveCards
@@ -5,24 +5,52 @@
 
 namespace AdaptiveCards
 {
+// Case folding for the case insensitive containers below. Only ASCII letters are folded: every key we look up this
+// way (element types, enum values, feature names) is ASCII, and a locale independent fold keeps the hash and the
+// equality comparison in agreement whatever the input.
+template <typename CharT>
+constexpr CharT ToUpperAscii(CharT c) noexcept
+{
+    return (c >= 'a' && c <= 'z') ? static_cast<CharT>(c - ('a' - 'A')) : c;
+}
+
 struct CaseInsensitiveEqualTo
 {
     template <typename T>
-    bool operator()(T const& lhs, T const& rhs) const noexcept
+    constexpr bool operator()(T const& lhs, T const& rhs) const noexcept
     {
-        return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs), [](auto a, auto b) {
-            return std::toupper(a) == std::toupper(b);
-        });
+        auto left = std::begin(lhs);
+        auto right = std::begin(rhs);
+        for (; left != std::end(lhs) && right != std::end(rhs); ++left, ++right)
+        {
+            if (ToUpperAscii(*left) != ToUpperAscii(*right))
+            {
+                return false;
+            }
+        }
+        return left == std::end(lhs) && right == std::end(rhs);
     }
 };
 
+// FNV-1a over the case folded characters. Doesn't allocate, and unlike a plain sum of the characters it doesn't
+// put anagrams and near-identical keys in the same bucket.
 struct CaseInsensitiveHash
 {
     template <typename T>
-    size_t operator()(T const& keyval) const noexcept
+    constexpr size_t operator()(T const& keyval) const noexcept
     {
-        return std::accumulate(
-            std::cbegin(keyval), std::cend(keyval), size_t{0}, [](size_t acc, auto c) { return acc + std::toupper(c); });
+        constexpr bool is64Bit = sizeof(size_t) >= 8;
+        constexpr size_t offsetBasis = is64Bit ? static_cast<size_t>(14695981039346656037ULL) : 2166136261U;
+        constexpr size_t prime = is64Bit ? static_cast<size_t>(1099511628211ULL) : 16777619U;
+
+        size_t hash = offsetBasis;
+        for (auto c : keyval)
+        {
+            using UnsignedChar = std::make_unsigned_t<decltype(c)>;
+            hash ^= static_cast<size_t>(static_cast<UnsignedChar>(ToUpperAscii(c)));
+            hash *= prime;
+        }
+        return hash;
     }
 };
 
@@ -37,46 +65,131 @@ struct EnumHash
 
 namespace EnumHelpers
 {
-    // Manage mapping T<->std::string using two internal unordered_maps.
+    // One row of an enum's string table, as written in Enums.cpp. Aliases are extra spellings that FromString accepts
+    // (e.g. for back compat) but ToString never produces.
     template <typename T>
-    class EnumMapping
+    struct EnumEntry
     {
-    public:
-        // Initialize with a single list -> automatically generate reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) :
-            _enumToString{t.begin(), t.end()}, _stringToEnum(t.size())
+        T value;
+        std::string_view name;
+        bool isAlias = false;
+    };
+
+    constexpr bool Alias = true;
+
+    template <typename T, size_t EntryCount>
+    constexpr size_t GetValueCount(const EnumEntry<T> (&entries)[EntryCount])
+    {
+        size_t valueCount = 0;
+        for (const auto& entry : entries)
         {
-            _GenerateStringToEnumMap();
+            valueCount = std::max(valueCount, static_cast<size_t>(entry.value) + 1);
         }
+        return valueCount;
+    }
 
-        // Initialize with two lists -> t1 is our forward list and t2 contains additional terms to use in addition
-        // to the generated reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t1, const std::initializer_list<std::pair<std::string, T>>& t2) :
-            _enumToString{t1.begin(), t1.end()}, _stringToEnum(t2.begin(), t2.end())
+    // Keeps the string -> enum table at most half full, so most lookups only look at one slot.
+    constexpr size_t GetSlotCount(size_t entryCount)
+    {
+        size_t slotCount = 1;
+        while (slotCount < 2 * entryCount)
+        {
+            slotCount *= 2;
+        }
+        return slotCount;
+    }
+
+    // An enum's string tables, built entirely at compile time. Strings are found by enum value by indexing names,
+    // and enum values are found by string in slots, an open addressed (linearly probed) hash table of entries.
+    template <typename T, size_t EntryCount, size_t ValueCount, size_t SlotCount>
+    struct EnumTable
+    {
+        std::array<EnumEntry<T>, EntryCount> entries;
+        std::array<std::string_view, ValueCount> names;
+        std::array<size_t, SlotCount> slots; // index into entries + 1, or 0 for an empty slot
+
+        constexpr EnumTable(const EnumEntry<T> (&tableEntries)[EntryCount]) : entries{}, names{}, slots{}
+        {
+            for (size_t i = 0; i < EntryCount; i++)
+            {
+                entries[i] = tableEntries[i];
+                if (!entries[i].isAlias)
+                {
+                    names[static_cast<size_t>(entries[i].value)] = entries[i].name;
+                }
+            }
+
+            // Walk the entries backwards so that if two of them share a string, FromString finds the later one.
+            for (size_t i = EntryCount; i-- > 0;)
+            {
+                size_t slot = CaseInsensitiveHash{}(entries[i].name) & (SlotCount - 1);
+                while (slots[slot] != 0 && !CaseInsensitiveEqualTo{}(entries[slots[slot] - 1].name, entries[i].name))
+                {
+                    slot = (slot + 1) & (SlotCount - 1);
+                }
+
+                if (slots[slot] == 0)
+                {
+                    slots[slot] = i + 1;
+                }
+            }
+        }
+    };
+
+    // Manage mapping T<->std::string using an EnumTable.
+    template <typename T>
+    class EnumMapping
+    {
+    public:
+        template <size_t EntryCount, size_t ValueCount, size_t SlotCount>
+        constexpr EnumMapping(const EnumTable<T, EntryCount, ValueCount, SlotCount>& table) :
+            _entries(table.entries.data()), _names(table.names.data()), _valueCount(ValueCount),
+            _slots(table.slots.data()), _slotMask(SlotCount - 1)
         {
-            _GenerateStringToEnumMap();
         }
 
         const std::string& toString(T t) const
         {
-            return _enumToString.at(t);
+            const auto index = static_cast<size_t>(t);
+            if (index >= _valueCount || _names[index].empty())
+            {
+                throw std::out_of_range("No string for enum value " + std::to_string(index));
+            }
+
+            // std::string can't be constructed at compile time, so the strings are made from the table on first use
+            static const std::vector<std::string> strings(_names, _names + _valueCount);
+            return strings[index];
         }
-        T fromString(const std::string& str) const
+
+        std::optional<T> tryFromString(const std::string& str) const
         {
-            return _stringToEnum.at(str);
+            const std::string_view key{str};
+            for (size_t slot = CaseInsensitiveHash{}(key) & _slotMask; _slots[slot] != 0; slot = (slot + 1) & _slotMask)
+            {
+                const EnumEntry<T>& entry = _entries[_slots[slot] - 1];
+                if (CaseInsensitiveEqualTo{}(entry.name, key))
+                {
+                    return entry.value;
+                }
+            }
+            return std::nullopt;
         }
 
-    private:
-        inline void _GenerateStringToEnumMap()
+        T fromString(const std::string& str) const
         {
-            for (const auto& kv : _enumToString)
+            if (const auto value = tryFromString(str))
             {
-                _stringToEnum.emplace(kv.second, kv.first);
+                return *value;
             }
+            throw std::out_of_range("No enum value for " + str);
         }
 
-        const std::unordered_map<T, std::string, EnumHash> _enumToString;
-        std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> _stringToEnum;
+    private:
+        const EnumEntry<T>* _entries;
+        const std::string_view* _names;
+        size_t _valueCount;
+        const size_t* _slots;
+        size_t _slotMask;
     };
 } // namespace EnumHelpers
 
@@ -89,12 +202,17 @@ namespace EnumHelpers
     const std::string& ENUMTYPE##ToString(const ENUMTYPE t); \
     ENUMTYPE ENUMTYPE##FromString(const std::string& t);
 
+// The tables are constant initialized, so there's no static initialization to do (or to wait on) before the
+// mapping functions can be used.
 #define _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, ...) \
     namespace EnumHelpers \
     { \
+        constexpr EnumEntry<ENUMTYPE> c_##ENUMTYPE##Entries[] = __VA_ARGS__; \
+        constexpr EnumTable<ENUMTYPE, std::size(c_##ENUMTYPE##Entries), GetValueCount(c_##ENUMTYPE##Entries), GetSlotCount(std::size(c_##ENUMTYPE##Entries))> \
+            c_##ENUMTYPE##Table{c_##ENUMTYPE##Entries}; \
         const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum() \
         { \
-            static const EnumMapping<ENUMTYPE> generatedEnum __VA_ARGS__; \
+            static constexpr EnumMapping<ENUMTYPE> generatedEnum{c_##ENUMTYPE##Table}; \
             return generatedEnum; \
         } \
     } \
@@ -108,13 +226,10 @@ namespace EnumHelpers
     _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, __VA_ARGS__); \
     ENUMTYPE ENUMTYPE##FromString(const std::string& t) \
     { \
-        try \
-        { \
-            return EnumHelpers::get##ENUMTYPE##Enum().fromString(t); \
-        } \
-        catch (const std::out_of_range&) \
+        if (const auto value = EnumHelpers::get##ENUMTYPE##Enum().tryFromString(t)) \
         { \
-            throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
+            return *value; \
         } \
+        throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
     }
 } // namespace AdaptiveCards
@@ -255,13 +255,9 @@ namespace AdaptiveCards
             {SeparatorThickness::Thick, "thick"}});
 
     DEFINE_ADAPTIVECARD_ENUM(ImageStyle, {
-            {
-                {ImageStyle::Default, "default"},
-                {ImageStyle::Person, "person"}
-            },
-            {
-                {"normal", ImageStyle::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            {ImageStyle::Default, "default"},
+            {ImageStyle::Person, "person"},
+            {ImageStyle::Default, "normal", EnumHelpers::Alias}}); // Back compat to support "Normal" for "Default" for pre V1.0 payloads
 
     DEFINE_ADAPTIVECARD_ENUM(VerticalAlignment, {
         { VerticalAlignment::Top, "top" },
@@ -300,26 +296,18 @@ namespace AdaptiveCards
             {TextStyle::Heading, "heading"}});
 
     DEFINE_ADAPTIVECARD_ENUM(TextWeight, {
-            {
-                {TextWeight::Bolder, "Bolder"},
-                {TextWeight::Lighter, "Lighter"},
-                {TextWeight::Default, "Default"}
-            },
-            {
-                {"Normal", TextWeight::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            {TextWeight::Bolder, "Bolder"},
+            {TextWeight::Lighter, "Lighter"},
+            {TextWeight::Default, "Default"},
+            {TextWeight::Default, "Normal", EnumHelpers::Alias}}); // Back compat to support "Normal" for "Default" for pre V1.0 payloads
 
     DEFINE_ADAPTIVECARD_ENUM(TextSize, {
-            {
-                {TextSize::ExtraLarge, "ExtraLarge"},
-                {TextSize::Large, "Large"},
-                {TextSize::Medium, "Medium"},
-                {TextSize::Default, "Default"},
-                {TextSize::Small, "Small"}
-            },
-            {
-                {"Normal", TextSize::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            {TextSize::ExtraLarge, "ExtraLarge"},
+            {TextSize::Large, "Large"},
+            {TextSize::Medium, "Medium"},
+            {TextSize::Default, "Default"},
+            {TextSize::Small, "Small"},
+            {TextSize::Default, "Normal", EnumHelpers::Alias}}); // Back compat to support "Normal" for "Default" for pre V1.0 payloads
 
     DEFINE_ADAPTIVECARD_ENUM(FontType, {
             {FontType::Default, "Default"},
@@ -473,6 +473,15 @@ enum class DateTimePreparsedTokenFormat
 };
 // No mapping to string needed
 
+enum class ColumnWidthType
+{
+    Auto = 0,
+    Stretch,
+    Weighted,
+    Pixels
+};
+// No mapping to string needed
+
 // We have to define all possible combinations because java doesn't allow bitwise operations between enum values
 // and it also limits the values an enum can have to only the values defined in the enum, so combinations wouldn't be
 // allowed unless they have been explicitly declared (i.e. 0x0101 wouldn't be valid as it was not part of the declared values)
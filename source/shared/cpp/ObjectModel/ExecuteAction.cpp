@@ -73,11 +73,16 @@ Json::Value ExecuteAction::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ExecuteAction::Clone() const
+{
+    return std::make_shared<ExecuteAction>(*this);
+}
+
 std::shared_ptr<BaseActionElement> ExecuteActionParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::shared_ptr<ExecuteAction> executeAction = BaseActionElement::Deserialize<ExecuteAction>(context, json);
 
-    executeAction->SetDataJson(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
+    executeAction->SetDataJson(ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Data));
     executeAction->SetVerb(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Verb));
     executeAction->SetAssociatedInputs(ParseUtil::GetEnumValue<AssociatedInputs>(
         json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsFromString));
@@ -92,8 +97,11 @@ std::shared_ptr<BaseActionElement> ExecuteActionParser::DeserializeFromString(Pa
 
 void ExecuteAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Verb),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Data,
+             AdaptiveCardSchemaKey::Verb,
+             AdaptiveCardSchemaKey::AssociatedInputs});
+    m_knownProperties = &knownProperties;
 }
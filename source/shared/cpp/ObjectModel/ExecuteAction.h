@@ -30,6 +30,7 @@ public:
     virtual void SetAssociatedInputs(const AssociatedInputs value);
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
 private:
     void PopulateKnownPropertiesSet();
@@ -7,14 +7,38 @@
 
 using namespace AdaptiveCards;
 
-Fact::Fact()
+Fact::Fact() : m_isMemoizationEnabled(false), m_isFrozen(false)
 {
 }
 
-Fact::Fact(std::string const& title, std::string const& value) : m_title(title), m_value(value)
+Fact::Fact(std::string const& title, std::string const& value) :
+    m_title(title), m_value(value), m_isMemoizationEnabled(false), m_isFrozen(false)
 {
 }
 
+Fact::Fact(const Fact& other) :
+    m_title(other.m_title), m_value(other.m_value), m_language(other.m_language),
+    m_memoizedTitleDateParsing(std::atomic_load(&other.m_memoizedTitleDateParsing)),
+    m_memoizedValueDateParsing(std::atomic_load(&other.m_memoizedValueDateParsing)),
+    m_isMemoizationEnabled(other.m_isMemoizationEnabled), m_isFrozen(other.m_isFrozen)
+{
+}
+
+Fact& Fact::operator=(const Fact& other)
+{
+    if (this != &other)
+    {
+        m_title = other.m_title;
+        m_value = other.m_value;
+        m_language = other.m_language;
+        std::atomic_store(&m_memoizedTitleDateParsing, std::atomic_load(&other.m_memoizedTitleDateParsing));
+        std::atomic_store(&m_memoizedValueDateParsing, std::atomic_load(&other.m_memoizedValueDateParsing));
+        m_isMemoizationEnabled = other.m_isMemoizationEnabled;
+        m_isFrozen = other.m_isFrozen;
+    }
+    return *this;
+}
+
 std::shared_ptr<Fact> Fact::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::string title = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, false);
@@ -59,6 +83,8 @@ std::string Fact::GetTitle() const
 void Fact::SetTitle(const std::string& value)
 {
     m_title = value;
+    m_isFrozen = false;
+    std::atomic_store(&m_memoizedTitleDateParsing, std::shared_ptr<const DateTimePreparser>());
 }
 
 std::string Fact::GetValue() const
@@ -69,16 +95,58 @@ std::string Fact::GetValue() const
 void Fact::SetValue(const std::string& value)
 {
     m_value = value;
+    m_isFrozen = false;
+    std::atomic_store(&m_memoizedValueDateParsing, std::shared_ptr<const DateTimePreparser>());
+}
+
+std::shared_ptr<const DateTimePreparser> Fact::GetTitleForDateParsing() const
+{
+    return _GetForDateParsing(m_title, m_memoizedTitleDateParsing);
+}
+
+std::shared_ptr<const DateTimePreparser> Fact::GetValueForDateParsing() const
+{
+    return _GetForDateParsing(m_value, m_memoizedValueDateParsing);
+}
+
+std::shared_ptr<const DateTimePreparser> Fact::_GetForDateParsing(
+    const std::string& text, std::shared_ptr<const DateTimePreparser>& memoized) const
+{
+    if (!m_isFrozen && !m_isMemoizationEnabled)
+    {
+        return std::make_shared<const DateTimePreparser>(text);
+    }
+
+    auto current = std::atomic_load(&memoized);
+    if (current)
+    {
+        return current;
+    }
+
+    // renderers on other threads may be making it too; only the first one made is kept, so that they all share it
+    const auto preparser = std::make_shared<const DateTimePreparser>(text);
+    if (std::atomic_compare_exchange_strong(&memoized, &current, preparser))
+    {
+        return preparser;
+    }
+    return current;
+}
+
+void Fact::SetMemoizationEnabled(bool enabled)
+{
+    m_isMemoizationEnabled = enabled;
 }
 
-DateTimePreparser Fact::GetTitleForDateParsing() const
+bool Fact::IsMemoizationEnabled() const
 {
-    return DateTimePreparser(m_title);
+    return m_isMemoizationEnabled;
 }
 
-DateTimePreparser Fact::GetValueForDateParsing() const
+void Fact::Freeze()
 {
-    return DateTimePreparser(m_value);
+    m_isFrozen = true;
+    GetTitleForDateParsing();
+    GetValueForDateParsing();
 }
 
 const std::string& Fact::GetLanguage() const
@@ -13,6 +13,11 @@ class Fact
 public:
     Fact();
     Fact(std::string const& title, std::string const& value);
+    // copying reads the memoized results atomically, as a renderer may be storing them meanwhile
+    Fact(const Fact&);
+    Fact(Fact&&) = default;
+    Fact& operator=(const Fact&);
+    Fact& operator=(Fact&&) = default;
 
     std::string Serialize();
     Json::Value SerializeToJsonValue();
@@ -22,8 +27,17 @@ public:
 
     std::string GetValue() const;
     void SetValue(const std::string& value);
-    DateTimePreparser GetTitleForDateParsing() const;
-    DateTimePreparser GetValueForDateParsing() const;
+    // the title and value split into dates and the text between them, memoized as
+    // TextElementProperties::GetTextForDateParsing is
+    std::shared_ptr<const DateTimePreparser> GetTitleForDateParsing() const;
+    std::shared_ptr<const DateTimePreparser> GetValueForDateParsing() const;
+
+    // see TextElementProperties::SetMemoizationEnabled
+    void SetMemoizationEnabled(bool enabled);
+    bool IsMemoizationEnabled() const;
+    // Preparses the title and value now, for FrozenCard, and memoizes them whether memoization is on or not. Nothing
+    // else may be using the fact meanwhile; changing the title or value afterwards undoes it.
+    void Freeze();
 
     void SetLanguage(const std::string& value);
     const std::string& GetLanguage() const;
@@ -32,8 +46,17 @@ public:
     static std::shared_ptr<Fact> DeserializeFromString(ParseContext& context, const std::string& jsonString);
 
 private:
+    std::shared_ptr<const DateTimePreparser> _GetForDateParsing(
+        const std::string& text, std::shared_ptr<const DateTimePreparser>& memoized) const;
+
     std::string m_title;
     std::string m_value;
     std::string m_language;
+
+    // memoized results, shared and replaced as TextElementProperties does its own
+    mutable std::shared_ptr<const DateTimePreparser> m_memoizedTitleDateParsing;
+    mutable std::shared_ptr<const DateTimePreparser> m_memoizedValueDateParsing;
+    bool m_isMemoizationEnabled;
+    bool m_isFrozen;
 };
 } // namespace AdaptiveCards
@@ -37,6 +37,13 @@ Json::Value FactSet::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> FactSet::Clone() const
+{
+    auto clone = std::make_shared<FactSet>(*this);
+    CopyEach(clone->m_facts);
+    return clone;
+}
+
 std::shared_ptr<BaseCardElement> FactSetParser::Deserialize(ParseContext& context, const Json::Value& value)
 {
     ParseUtil::ExpectTypeString(value, CardElementType::FactSet);
@@ -65,5 +72,7 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(ParseConte
 
 void FactSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::Facts});
+    m_knownProperties = &knownProperties;
 }
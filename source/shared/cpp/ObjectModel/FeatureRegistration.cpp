@@ -9,27 +9,29 @@
 namespace AdaptiveCards
 {
 FeatureRegistration::FeatureRegistration() :
-    m_supportedFeatures{{AdaptiveCards::c_adaptiveCardsFeature, c_sharedModelVersion}}
+    m_supportedFeatures{{AdaptiveCards::c_adaptiveCardsFeature, {c_sharedModelVersion, SemanticVersion(c_sharedModelVersion)}}}
 {
 }
 
 void FeatureRegistration::AddFeature(std::string const& featureName, const std::string& featureVersion)
 {
     // first, validate the version string. we only support "*" or a semantic version string (e.g. "1.0", or "1.2.3.4")
+    std::optional<SemanticVersion> semanticVersion;
     if (featureVersion != "*")
     {
         // the below will throw if the version is invalid
-        const SemanticVersion version(featureVersion);
+        semanticVersion.emplace(featureVersion);
     }
 
-    if (m_supportedFeatures.find(featureName) == m_supportedFeatures.end())
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature == m_supportedFeatures.end())
     {
-        m_supportedFeatures[featureName] = featureVersion;
+        m_supportedFeatures.emplace(featureName, Feature{featureVersion, semanticVersion});
     }
     else
     {
         // only allow a duplicate add attempt if the version is the same.
-        if (m_supportedFeatures[featureName] != featureVersion)
+        if (feature->second.version != featureVersion)
         {
             throw AdaptiveCardParseException(
                 ErrorStatusCode::InvalidPropertyValue, "Attempting to add a feature with a differing version");
@@ -50,19 +52,29 @@ void FeatureRegistration::RemoveFeature(const std::string& featureName)
 
 SemanticVersion FeatureRegistration::GetAdaptiveCardsVersion() const
 {
-    SemanticVersion adaptiveCardsVersion{GetFeatureVersion(AdaptiveCards::c_adaptiveCardsFeature)};
-    return adaptiveCardsVersion;
+    return *m_supportedFeatures.at(AdaptiveCards::c_adaptiveCardsFeature).semanticVersion;
 }
 
 std::string FeatureRegistration::GetFeatureVersion(const std::string& featureName) const
 {
-    if (m_supportedFeatures.find(featureName) != m_supportedFeatures.end())
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature != m_supportedFeatures.end())
     {
-        return m_supportedFeatures.at(featureName);
+        return feature->second.version;
     }
     else
     {
         return "";
     }
 }
+
+const SemanticVersion* FeatureRegistration::GetFeatureSemanticVersion(const std::string& featureName) const
+{
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature != m_supportedFeatures.end() && feature->second.semanticVersion.has_value())
+    {
+        return &feature->second.semanticVersion.value();
+    }
+    return nullptr;
+}
 } // namespace AdaptiveCards
@@ -4,6 +4,7 @@
 
 #include "pch.h"
 #include "ParseUtil.h"
+#include "SemanticVersion.h"
 
 namespace AdaptiveCards
 {
@@ -14,11 +15,12 @@ namespace ParseUtil
     std::string ToLowercase(const std::string& value);
 }
 
+// Kept for existing callers; these share the allocation free implementations in EnumMagic.h.
 struct CaseInsensitiveKeyHash
 {
     size_t operator()(const std::string& keyVal) const
     {
-        return std::hash<std::string>{}(ParseUtil::ToLowercase(keyVal));
+        return CaseInsensitiveHash{}(keyVal);
     }
 };
 
@@ -26,11 +28,10 @@ struct CaseInsensitiveKeyEquals
 {
     bool operator()(const std::string& leftVal, const std::string& rightVal) const
     {
-        return (ParseUtil::ToLowercase(leftVal) == ParseUtil::ToLowercase(rightVal));
+        return CaseInsensitiveEqualTo{}(leftVal, rightVal);
     }
 };
 
-class SemanticVersion;
 class FeatureRegistration
 {
 public:
@@ -41,7 +42,17 @@ public:
     SemanticVersion GetAdaptiveCardsVersion() const;
     std::string GetFeatureVersion(const std::string& featureName) const;
 
+    // The version of featureName, parsed when it was registered. Null if featureName isn't registered, or was
+    // registered as "*".
+    const SemanticVersion* GetFeatureSemanticVersion(const std::string& featureName) const;
+
 private:
-    std::unordered_map<std::string, std::string, CaseInsensitiveKeyHash, CaseInsensitiveKeyEquals> m_supportedFeatures;
+    struct Feature
+    {
+        std::string version;
+        std::optional<SemanticVersion> semanticVersion;
+    };
+
+    std::unordered_map<std::string, Feature, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_supportedFeatures;
 };
 } // namespace AdaptiveCards
@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "FrozenCard.h"
+#include "ElementTraversal.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+namespace AdaptiveCards
+{
+std::shared_ptr<const FrozenCard> FrozenCard::Freeze(std::shared_ptr<AdaptiveCard> card)
+{
+    // the constructor is private, so make_shared can't be used
+    return std::shared_ptr<const FrozenCard>(new FrozenCard(std::move(card), {}));
+}
+
+std::shared_ptr<const FrozenCard> FrozenCard::Freeze(const ParseResult& parseResult)
+{
+    return std::shared_ptr<const FrozenCard>(new FrozenCard(parseResult.GetAdaptiveCard(), parseResult.GetWarnings()));
+}
+
+FrozenCard::FrozenCard(std::shared_ptr<AdaptiveCard> card, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings) :
+    m_warnings(std::move(warnings)), m_resourceInformation(card->GetResourceInformation())
+{
+    _AddCard(*card);
+    m_card = std::move(card);
+}
+
+std::shared_ptr<const BaseElement> FrozenCard::GetElementById(const std::string& id) const
+{
+    const auto element = m_elementsById.find(id);
+    return element == m_elementsById.end() ? nullptr : element->second;
+}
+
+void FrozenCard::_AddCard(AdaptiveCard& card)
+{
+    VisitChildren(card, [this](const auto& child) { _Add(child); });
+}
+
+void FrozenCard::_AddId(const std::shared_ptr<BaseElement>& element)
+{
+    if (!element->GetId().empty())
+    {
+        m_elementsById.emplace(element->GetId(), element);
+    }
+}
+
+void FrozenCard::_Add(const std::shared_ptr<BaseCardElement>& element)
+{
+    _AddId(element);
+
+    if (element->GetElementType() == CardElementType::TextBlock)
+    {
+        std::static_pointer_cast<TextBlock>(element)->FreezeText();
+    }
+    else if (element->GetElementType() == CardElementType::RichTextBlock)
+    {
+        for (const auto& inlineElement : std::static_pointer_cast<RichTextBlock>(element)->GetInlines())
+        {
+            if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+            {
+                std::static_pointer_cast<TextRun>(inlineElement)->FreezeText();
+            }
+        }
+    }
+    else if (element->GetElementType() == CardElementType::FactSet)
+    {
+        for (const auto& fact : std::static_pointer_cast<FactSet>(element)->GetFacts())
+        {
+            fact->Freeze();
+        }
+    }
+    VisitChildren(*element, [this](const auto& child) { _Add(child); });
+}
+
+void FrozenCard::_Add(const std::shared_ptr<BaseActionElement>& action)
+{
+    _AddId(action);
+    if (action->GetElementType() == ActionType::ShowCard)
+    {
+        if (const auto card = std::static_pointer_cast<ShowCardAction>(action)->GetCard())
+        {
+            _AddCard(*card);
+        }
+    }
+}
+} // namespace AdaptiveCards
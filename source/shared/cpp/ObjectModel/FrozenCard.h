@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+namespace AdaptiveCards
+{
+// A parsed card made read-only, so that one parse can be rendered by any number of threads at once. Freezing
+// does up front what rendering would otherwise do lazily on each thread:
+//  - the text of every TextBlock and TextRun is preparsed for dates, and the markdown of text without dates is
+//    transformed; both are kept on the elements (see TextElementProperties::Freeze), where GetTextForDateParsing
+//    and GetMarkDownResult find them
+//  - the title and value of every Fact is preparsed for dates, and kept on the fact (see Fact::Freeze)
+//  - the card's remote resources are listed
+//  - every element and action with an id is indexed by it
+//
+// FrozenCard hands out the card only as const. The elements it holds are still shared_ptrs to mutable objects,
+// so the guarantee is a contract: once a card is frozen, nothing may change it, through this or any other
+// reference. Given that, every const member function of the card, its elements and this class may be called from
+// any number of threads at once.
+class FrozenCard
+{
+public:
+    // Freezes card, which must not be in use elsewhere while it is frozen, nor changed afterwards.
+    static std::shared_ptr<const FrozenCard> Freeze(std::shared_ptr<AdaptiveCard> card);
+    // Freezes the card of parseResult, and keeps the warnings of the parse with it
+    static std::shared_ptr<const FrozenCard> Freeze(const ParseResult& parseResult);
+
+    FrozenCard(const FrozenCard&) = delete;
+    FrozenCard& operator=(const FrozenCard&) = delete;
+
+    std::shared_ptr<const AdaptiveCard> GetCard() const
+    {
+        return m_card;
+    }
+
+    const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& GetWarnings() const
+    {
+        return m_warnings;
+    }
+
+    // what AdaptiveCard::GetResourceInformation returned when the card was frozen
+    const std::vector<RemoteResourceInformation>& GetResourceInformation() const
+    {
+        return m_resourceInformation;
+    }
+
+    // The element or action with the given id, or null if there is none. Fallback content isn't indexed, as it
+    // may reuse the ids of the elements it stands in for; where the card itself repeats an id, the first element
+    // with it, in document order, is returned.
+    std::shared_ptr<const BaseElement> GetElementById(const std::string& id) const;
+
+private:
+    FrozenCard(std::shared_ptr<AdaptiveCard> card, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings);
+
+    // freeze the text of, and index, what's in the card or element and everything under it
+    void _AddCard(AdaptiveCard& card);
+    void _AddId(const std::shared_ptr<BaseElement>& element);
+    void _Add(const std::shared_ptr<BaseCardElement>& element);
+    void _Add(const std::shared_ptr<BaseActionElement>& action);
+
+    std::shared_ptr<const AdaptiveCard> m_card;
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
+    std::vector<RemoteResourceInformation> m_resourceInformation;
+    std::unordered_map<std::string, std::shared_ptr<const BaseElement>> m_elementsById;
+};
+} // namespace AdaptiveCards
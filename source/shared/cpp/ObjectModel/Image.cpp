@@ -80,6 +80,72 @@ Json::Value Image::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> Image::Clone() const
+{
+    return std::make_shared<Image>(*this);
+}
+
+void Image::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<Image>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::WriteProperties(writer);
+
+    if (m_pixelWidth || m_pixelHeight)
+    {
+        if (m_pixelWidth)
+        {
+            writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width), std::to_string(m_pixelWidth) + "px");
+        }
+        if (m_pixelHeight)
+        {
+            writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height), std::to_string(m_pixelHeight) + "px");
+        }
+    }
+    else if (m_imageSize != ImageSize::None)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size), ImageSizeToString(m_imageSize));
+    }
+
+    if (m_imageStyle != ImageStyle::Default)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style), ImageStyleToString(m_imageStyle));
+    }
+
+    if (!m_url.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url), m_url);
+    }
+
+    if (!m_backgroundColor.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor), m_backgroundColor);
+    }
+
+    if (m_hAlignment.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
+                        HorizontalAlignmentToString(m_hAlignment.value_or(HorizontalAlignment::Left)));
+    }
+
+    if (!m_altText.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText), m_altText);
+    }
+
+    if (m_selectAction != nullptr)
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction));
+        m_selectAction->SerializeTo(writer);
+    }
+    writer.EndObject();
+}
+
 std::string Image::GetUrl() const
 {
     return m_url;
@@ -215,16 +281,19 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
 void Image::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::AltText,
+             AdaptiveCardSchemaKey::BackgroundColor,
+             AdaptiveCardSchemaKey::Height,
+             AdaptiveCardSchemaKey::HorizontalAlignment,
+             AdaptiveCardSchemaKey::SelectAction,
+             AdaptiveCardSchemaKey::Size,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::Url,
+             AdaptiveCardSchemaKey::Width});
+    m_knownProperties = &knownProperties;
 }
 
 void Image::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
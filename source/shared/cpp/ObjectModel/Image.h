@@ -20,6 +20,8 @@ public:
     ~Image() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
+    void SerializeTo(JsonWriter& writer) const override;
 
     std::string GetUrl() const;
     void SetUrl(const std::string& value);
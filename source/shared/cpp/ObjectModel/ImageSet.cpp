@@ -52,6 +52,11 @@ Json::Value ImageSet::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ImageSet::Clone() const
+{
+    return std::make_shared<ImageSet>(*this);
+}
+
 std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& context, const Json::Value& value)
 {
     ParseUtil::ExpectTypeString(value, CardElementType::ImageSet);
@@ -80,9 +85,9 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(ParseCont
 
 void ImageSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::Images, AdaptiveCardSchemaKey::ImageSize});
+    m_knownProperties = &knownProperties;
 }
 
 void ImageSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -22,6 +22,7 @@ public:
     ~ImageSet() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     ImageSize GetImageSize() const;
     void SetImageSize(const ImageSize value);
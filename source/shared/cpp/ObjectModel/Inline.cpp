@@ -20,6 +20,11 @@ Json::Value Inline::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<Inline> Inline::Clone() const
+{
+    return std::make_shared<Inline>(*this);
+}
+
 InlineElementType Inline::GetInlineType() const
 {
     return m_type;
@@ -53,5 +58,6 @@ std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::V
 
 void Inline::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const std::unordered_set<std::string> knownProperties{AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)};
+    m_knownProperties = &knownProperties;
 }
@@ -21,6 +21,8 @@ public:
     virtual ~Inline() = default;
 
     virtual Json::Value SerializeToJsonValue() const;
+    // a copy of this inline, for BaseElement::Clone
+    virtual std::shared_ptr<Inline> Clone() const;
 
     // Element type
     virtual InlineElementType GetInlineType() const;
@@ -33,7 +35,8 @@ public:
     void SetAdditionalProperties(const Json::Value& additionalProperties);
 
 protected:
-    std::unordered_set<std::string> m_knownProperties;
+    // shared by every instance of the type, see BaseElement::ExtendKnownProperties
+    const std::unordered_set<std::string>* m_knownProperties = nullptr;
     Json::Value m_additionalProperties;
 
 private:
@@ -8,6 +8,9 @@ namespace AdaptiveCards
 {
 // Used to uniquely identify a single BaseElement-derived object through the course of deserializing. For more
 // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
+//
+// Next() is safe to call from multiple threads; IDs are unique across threads. Current() returns the ID most
+// recently handed out on the calling thread.
 class InternalId
 {
 public:
@@ -40,7 +43,6 @@ public:
     }
 
 private:
-    static unsigned int s_currentInternalId;
     InternalId(const unsigned int id);
     unsigned int m_internalId;
 };
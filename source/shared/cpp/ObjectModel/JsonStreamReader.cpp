@@ -0,0 +1,185 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "JsonStreamReader.h"
+
+namespace AdaptiveCards
+{
+JsonStreamReader::JsonStreamReader(const char* begin, const char* end) : m_current(begin), m_end(end), m_failed(false)
+{
+}
+
+bool JsonStreamReader::Fail()
+{
+    m_failed = true;
+    return false;
+}
+
+// jsoncpp accepts C and C++ style comments by default, so we have to as well
+void JsonStreamReader::SkipWhitespaceAndComments()
+{
+    while (m_current != m_end)
+    {
+        const char c = *m_current;
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        {
+            ++m_current;
+        }
+        else if (c == '/' && (m_end - m_current) >= 2 && m_current[1] == '/')
+        {
+            m_current += 2;
+            while (m_current != m_end && *m_current != '\n' && *m_current != '\r')
+            {
+                ++m_current;
+            }
+        }
+        else if (c == '/' && (m_end - m_current) >= 2 && m_current[1] == '*')
+        {
+            m_current += 2;
+            while ((m_end - m_current) >= 2 && !(m_current[0] == '*' && m_current[1] == '/'))
+            {
+                ++m_current;
+            }
+
+            if ((m_end - m_current) < 2)
+            {
+                // unterminated comment
+                m_current = m_end;
+                m_failed = true;
+                return;
+            }
+            m_current += 2;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+char JsonStreamReader::Peek()
+{
+    SkipWhitespaceAndComments();
+    return (m_failed || m_current == m_end) ? '\0' : *m_current;
+}
+
+bool JsonStreamReader::TryConsume(char expected)
+{
+    if (Peek() == expected)
+    {
+        ++m_current;
+        return true;
+    }
+    return false;
+}
+
+// Expects m_current to point at an opening quote. On success, m_current points just past the closing quote.
+bool JsonStreamReader::SkipString()
+{
+    ++m_current;
+    while (m_current != m_end)
+    {
+        const char c = *m_current++;
+        if (c == '"')
+        {
+            return true;
+        }
+
+        if (c == '\\')
+        {
+            if (m_current == m_end)
+            {
+                break;
+            }
+            ++m_current;
+        }
+    }
+    return Fail();
+}
+
+bool JsonStreamReader::ReadRawString(std::string_view& value)
+{
+    if (Peek() != '"')
+    {
+        return Fail();
+    }
+
+    const char* start = m_current;
+    if (!SkipString())
+    {
+        return false;
+    }
+
+    value = std::string_view(start + 1, static_cast<size_t>(m_current - start - 2));
+    return true;
+}
+
+bool JsonStreamReader::SkipValue(std::string_view& value)
+{
+    const char first = Peek();
+    const char* start = m_current;
+
+    if (first == '"')
+    {
+        if (!SkipString())
+        {
+            return false;
+        }
+    }
+    else if (first == '{' || first == '[')
+    {
+        // walk to the matching bracket. Brackets inside strings and comments don't count.
+        std::vector<char> expectedClose;
+        do
+        {
+            const char c = Peek();
+            if (c == '"')
+            {
+                if (!SkipString())
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            if (c == '{' || c == '[')
+            {
+                expectedClose.push_back(c == '{' ? '}' : ']');
+            }
+            else if (c == '}' || c == ']')
+            {
+                if (expectedClose.back() != c)
+                {
+                    return Fail();
+                }
+                expectedClose.pop_back();
+            }
+            else if (c == '\0')
+            {
+                return Fail();
+            }
+            ++m_current;
+        } while (!expectedClose.empty());
+    }
+    else if (first == '-' || isdigit(static_cast<unsigned char>(first)) || first == 't' || first == 'f' || first == 'n')
+    {
+        // numbers and literals run up to the next delimiter
+        while (m_current != m_end)
+        {
+            const char c = *m_current;
+            if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '/')
+            {
+                break;
+            }
+            ++m_current;
+        }
+    }
+    else
+    {
+        return Fail();
+    }
+
+    value = std::string_view(start, static_cast<size_t>(m_current - start));
+    return !m_failed;
+}
+} // namespace AdaptiveCards
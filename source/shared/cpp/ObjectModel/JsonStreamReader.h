@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// Forward-only JSON scanner used to split a card into its top level elements (see
+// AdaptiveCard::DeserializeFromStringByElement). It walks the source text in place without building a Json::Value
+// tree or copying strings: member names and values are handed back as views into the source. Values are not
+// decoded -- callers that need a value's contents materialize just that value with ParseUtil.
+//
+// The scanner only validates structure (matching brackets, terminated strings and comments). It never throws;
+// instead every method reports failure through its return value and leaves the reader in a failed state, so
+// callers can fall back to the regular Json::Value based path and get its error reporting.
+class JsonStreamReader
+{
+public:
+    JsonStreamReader(const char* begin, const char* end);
+
+    // Consumes the given structural character ('{', '}', '[', ']', ':' or ',') if it is the next token.
+    bool TryConsume(char expected);
+
+    // Returns the next non-whitespace character without consuming it, or '\0' at end of input.
+    char Peek();
+
+    // Reads a string token and returns its raw (still escaped) contents, excluding the quotes.
+    bool ReadRawString(std::string_view& value);
+
+    // Skips over the next value (of any type) and returns its complete source text.
+    bool SkipValue(std::string_view& value);
+
+    bool HasFailed() const
+    {
+        return m_failed;
+    }
+
+private:
+    void SkipWhitespaceAndComments();
+    bool SkipString();
+    bool Fail();
+
+    const char* m_current;
+    const char* m_end;
+    bool m_failed;
+};
+} // namespace AdaptiveCards
@@ -0,0 +1,364 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "JsonWriter.h"
+
+namespace
+{
+constexpr char c_hexDigits[] = "0123456789abcdef";
+constexpr unsigned int c_replacementCharacter = 0xFFFD;
+
+// Decodes the code point starting at *current and leaves current on its last byte. Invalid sequences decode to
+// U+FFFD the same way jsoncpp's writer decodes them, so strings come out as Json::Value would write them.
+unsigned int DecodeCodePoint(const char*& current, const char* end)
+{
+    const unsigned int firstByte = static_cast<unsigned char>(*current);
+    const auto continuation = [&](int index) { return static_cast<unsigned int>(current[index]) & 0x3F; };
+
+    if (firstByte < 0x80)
+    {
+        return firstByte;
+    }
+
+    if (firstByte < 0xE0)
+    {
+        if (end - current < 2)
+        {
+            return c_replacementCharacter;
+        }
+        const unsigned int codePoint = ((firstByte & 0x1F) << 6) | continuation(1);
+        current += 1;
+        return codePoint < 0x80 ? c_replacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF0)
+    {
+        if (end - current < 3)
+        {
+            return c_replacementCharacter;
+        }
+        const unsigned int codePoint = ((firstByte & 0x0F) << 12) | (continuation(1) << 6) | continuation(2);
+        current += 2;
+        if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+        {
+            return c_replacementCharacter;
+        }
+        return codePoint < 0x800 ? c_replacementCharacter : codePoint;
+    }
+
+    if (firstByte < 0xF8)
+    {
+        if (end - current < 4)
+        {
+            return c_replacementCharacter;
+        }
+        const unsigned int codePoint =
+            ((firstByte & 0x07) << 24) | (continuation(1) << 12) | (continuation(2) << 6) | continuation(3);
+        current += 3;
+        return codePoint < 0x10000 ? c_replacementCharacter : codePoint;
+    }
+
+    return c_replacementCharacter;
+}
+
+void AppendUnicodeEscape(unsigned int codeUnit, std::string& output)
+{
+    const char escape[] = {'\\',
+                           'u',
+                           c_hexDigits[(codeUnit >> 12) & 0xF],
+                           c_hexDigits[(codeUnit >> 8) & 0xF],
+                           c_hexDigits[(codeUnit >> 4) & 0xF],
+                           c_hexDigits[codeUnit & 0xF]};
+    output.append(escape, sizeof(escape));
+}
+
+template <typename T> void AppendInteger(T value, std::string& output)
+{
+    char digits[24];
+    const auto result = std::to_chars(std::begin(digits), std::end(digits), value);
+    output.append(digits, result.ptr);
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+void JsonWriter::BeginObject()
+{
+    BeginValue();
+    m_output += '{';
+    m_containers.push_back({true, 0, m_properties.size(), true});
+}
+
+void JsonWriter::EndObject()
+{
+    const Container& object = m_containers.back();
+    if (object.firstProperty < m_properties.size())
+    {
+        if (!object.isSorted)
+        {
+            SortProperties(object);
+        }
+        m_names.resize(m_properties[object.firstProperty].nameOffset);
+        m_properties.resize(object.firstProperty);
+    }
+
+    m_output += '}';
+    m_containers.pop_back();
+}
+
+void JsonWriter::BeginArray()
+{
+    BeginValue();
+    m_output += '[';
+    m_containers.push_back({false, 0, 0, true});
+}
+
+void JsonWriter::EndArray()
+{
+    m_output += ']';
+    m_containers.pop_back();
+}
+
+void JsonWriter::Key(std::string_view name)
+{
+    Container& object = m_containers.back();
+    if (object.valueCount++ > 0)
+    {
+        m_output += ',';
+    }
+
+    if (object.isSorted && object.firstProperty < m_properties.size() && !(GetName(m_properties.back()) < name))
+    {
+        object.isSorted = false;
+    }
+
+    m_properties.push_back({m_names.size(), name.size(), m_output.size()});
+    m_names.append(name);
+
+    AppendQuoted(name);
+    m_output += ':';
+}
+
+void JsonWriter::String(std::string_view value)
+{
+    BeginValue();
+    AppendQuoted(value);
+}
+
+void JsonWriter::Bool(bool value)
+{
+    BeginValue();
+    m_output += value ? "true" : "false";
+}
+
+void JsonWriter::Int(int value)
+{
+    BeginValue();
+    AppendInteger(value, m_output);
+}
+
+void JsonWriter::UInt(unsigned int value)
+{
+    BeginValue();
+    AppendInteger(value, m_output);
+}
+
+void JsonWriter::Double(double value)
+{
+    BeginValue();
+    m_output += Json::valueToString(value);
+}
+
+void JsonWriter::Null()
+{
+    BeginValue();
+    m_output += "null";
+}
+
+void JsonWriter::Value(const Json::Value& value)
+{
+    switch (value.type())
+    {
+    case Json::intValue:
+        BeginValue();
+        AppendInteger(value.asLargestInt(), m_output);
+        break;
+    case Json::uintValue:
+        BeginValue();
+        AppendInteger(value.asLargestUInt(), m_output);
+        break;
+    case Json::realValue:
+        Double(value.asDouble());
+        break;
+    case Json::stringValue:
+    {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        value.getString(&begin, &end);
+        String(std::string_view(begin, end - begin));
+        break;
+    }
+    case Json::booleanValue:
+        Bool(value.asBool());
+        break;
+    case Json::arrayValue:
+        BeginArray();
+        for (const auto& item : value)
+        {
+            Value(item);
+        }
+        EndArray();
+        break;
+    case Json::objectValue:
+        BeginObject();
+        Properties(value);
+        EndObject();
+        break;
+    default:
+        Null();
+        break;
+    }
+}
+
+void JsonWriter::Properties(const Json::Value& value)
+{
+    if (!value.isObject())
+    {
+        return;
+    }
+
+    for (auto member = value.begin(); member != value.end(); ++member)
+    {
+        const char* nameEnd = nullptr;
+        const char* name = member.memberName(&nameEnd);
+        Key(std::string_view(name, nameEnd - name));
+        Value(*member);
+    }
+}
+
+std::string JsonWriter::TakeString()
+{
+    std::string output = std::move(m_output);
+    Clear();
+    return output;
+}
+
+void JsonWriter::Clear()
+{
+    m_output.clear();
+    m_containers.clear();
+    m_properties.clear();
+    m_names.clear();
+}
+
+// a value in an array is separated from the one before it; values in an object are separated by Key
+void JsonWriter::BeginValue()
+{
+    if (!m_containers.empty() && !m_containers.back().isObject && m_containers.back().valueCount++ > 0)
+    {
+        m_output += ',';
+    }
+}
+
+// quotes and escapes value the way jsoncpp does, which leaves only printable ASCII unescaped
+void JsonWriter::AppendQuoted(std::string_view value)
+{
+    m_output += '"';
+
+    const char* const end = value.data() + value.size();
+    const char* plainStart = value.data();
+    for (const char* current = value.data(); current != end; ++current)
+    {
+        const unsigned char c = static_cast<unsigned char>(*current);
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        m_output.append(plainStart, current);
+        switch (c)
+        {
+        case '"':
+            m_output += "\\\"";
+            break;
+        case '\\':
+            m_output += "\\\\";
+            break;
+        case '\b':
+            m_output += "\\b";
+            break;
+        case '\f':
+            m_output += "\\f";
+            break;
+        case '\n':
+            m_output += "\\n";
+            break;
+        case '\r':
+            m_output += "\\r";
+            break;
+        case '\t':
+            m_output += "\\t";
+            break;
+        default:
+        {
+            unsigned int codePoint = DecodeCodePoint(current, end);
+            if (codePoint < 0x10000)
+            {
+                AppendUnicodeEscape(codePoint, m_output);
+            }
+            else
+            {
+                codePoint -= 0x10000;
+                AppendUnicodeEscape((codePoint >> 10) + 0xD800, m_output);
+                AppendUnicodeEscape((codePoint & 0x3FF) + 0xDC00, m_output);
+            }
+            break;
+        }
+        }
+        plainStart = current + 1;
+    }
+    m_output.append(plainStart, end);
+
+    m_output += '"';
+}
+
+// Puts the properties of the object being ended in order by name, keeping only the last of any that share a name.
+// The properties are copied out in their new order and back over the old ones.
+void JsonWriter::SortProperties(const Container& object)
+{
+    const auto first = m_properties.begin() + object.firstProperty;
+    const size_t bodyStart = first->start;
+
+    // where each property ends, before the properties are moved around: at the comma before the next, or at the end
+    std::vector<std::pair<PropertySpan, size_t>> spans;
+    spans.reserve(m_properties.end() - first);
+    for (auto property = first; property != m_properties.end(); ++property)
+    {
+        const size_t propertyEnd = (property + 1 == m_properties.end()) ? m_output.size() : (property + 1)->start - 1;
+        spans.emplace_back(*property, propertyEnd);
+    }
+
+    std::stable_sort(spans.begin(), spans.end(), [this](const auto& left, const auto& right) {
+        return GetName(left.first) < GetName(right.first);
+    });
+
+    m_scratch.clear();
+    for (auto span = spans.begin(); span != spans.end(); ++span)
+    {
+        // of the properties sharing a name, the last written is the last of them after a stable sort
+        if (span + 1 != spans.end() && GetName(span->first) == GetName((span + 1)->first))
+        {
+            continue;
+        }
+
+        if (!m_scratch.empty())
+        {
+            m_scratch += ',';
+        }
+        m_scratch.append(m_output, span->first.start, span->second - span->first.start);
+    }
+
+    m_output.resize(bodyStart);
+    m_output += m_scratch;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "json/json.h"
+
+namespace AdaptiveCards
+{
+// Writes compact JSON straight into a string, for serializing cards without building a Json::Value tree first.
+//
+// The output is the same as ParseUtil::JsonToString would give for the equivalent Json::Value (less the trailing
+// newline): properties of an object come out sorted by name however they were written, and when a name is written
+// more than once, the last value written wins, as with assigning to a Json::Value. Writing properties in sorted order
+// saves reordering them when the object ends.
+class JsonWriter
+{
+public:
+    JsonWriter() = default;
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    // names the next value written; only valid directly inside an object
+    void Key(std::string_view name);
+
+    void String(std::string_view value);
+    void Bool(bool value);
+    void Int(int value);
+    void UInt(unsigned int value);
+    void Double(double value);
+    void Null();
+    // writes a whole Json::Value, for the parts of a card that are kept as one
+    void Value(const Json::Value& value);
+
+    void Property(std::string_view name, std::string_view value)
+    {
+        Key(name);
+        String(value);
+    }
+    void Property(std::string_view name, const char* value)
+    {
+        Key(name);
+        String(value);
+    }
+    void Property(std::string_view name, bool value)
+    {
+        Key(name);
+        Bool(value);
+    }
+    void Property(std::string_view name, int value)
+    {
+        Key(name);
+        Int(value);
+    }
+    void Property(std::string_view name, unsigned int value)
+    {
+        Key(name);
+        UInt(value);
+    }
+
+    // writes the members of value into the object being written, as if each had been written with Key and Value
+    void Properties(const Json::Value& value);
+
+    const std::string& GetString() const
+    {
+        return m_output;
+    }
+    // hands over what has been written, leaving the writer empty
+    std::string TakeString();
+    // discards what has been written, keeping the capacity of the buffers for the next card
+    void Clear();
+
+private:
+    struct Container
+    {
+        bool isObject;
+        size_t valueCount;
+        // objects only: where their properties start in m_properties, and whether they are in order so far
+        size_t firstProperty;
+        bool isSorted;
+    };
+
+    // a property of an object still being written: its name, kept in m_names, and where it starts in m_output
+    struct PropertySpan
+    {
+        size_t nameOffset;
+        size_t nameLength;
+        size_t start;
+    };
+
+    void BeginValue();
+    void AppendQuoted(std::string_view value);
+    std::string_view GetName(const PropertySpan& property) const
+    {
+        return std::string_view(m_names).substr(property.nameOffset, property.nameLength);
+    }
+    void SortProperties(const Container& object);
+
+    std::string m_output;
+    std::vector<Container> m_containers;
+    std::vector<PropertySpan> m_properties;
+    std::string m_names;
+    std::string m_scratch;
+};
+} // namespace AdaptiveCards
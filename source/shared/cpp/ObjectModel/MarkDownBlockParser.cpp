@@ -1,13 +1,12 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
-#include <iostream>
 #include "MarkDownBlockParser.h"
 
 using namespace AdaptiveCards;
 
 // Parses according to each key words
-void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
+void MarkDownBlockParser::ParseBlock(MarkDownStream& stream)
 {
     switch (stream.peek())
     {
@@ -78,7 +77,7 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     }
 }
 
-void MarkDownBlockParser::ParseTextAndEmphasis(std::stringstream& stream)
+void MarkDownBlockParser::ParseTextAndEmphasis(MarkDownStream& stream)
 {
     EmphasisParser emphasisParser;
     // do syntax check of normal text + emphasis
@@ -92,11 +91,12 @@ void MarkDownBlockParser::ParseTextAndEmphasis(std::stringstream& stream)
 // capture until it can't capture anymore.
 // it moves two states, emphasis state and text state,
 // at each transition of state, one token is captured
-void EmphasisParser::Match(std::stringstream& stream)
+void EmphasisParser::Match(MarkDownStream& stream)
 {
     while (m_current_state != EmphasisState::Captured)
     {
-        m_current_state = m_stateMachine.at(m_current_state)(*this, stream, m_current_token);
+        m_current_state = (m_current_state == EmphasisState::Text) ? MatchText(*this, stream, m_current_token) :
+                                                                     MatchEmphasis(*this, stream, m_current_token);
     }
 }
 
@@ -106,7 +106,7 @@ bool EmphasisParser::IsEmphasisToken(int currentChar)
 }
 
 /// captures text until it see emphasis character. When it does, switch to Emphasis state
-EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser, std::stringstream& stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser, MarkDownStream& stream, std::string& token)
 {
     const int currentChar = stream.peek();
     const bool isEmphasisToken = IsEmphasisToken(currentChar);
@@ -153,7 +153,7 @@ EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser,
 }
 
 /// captures text until it see non-emphasis character. When it does, switch to text state
-EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& parser, std::stringstream& stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& parser, MarkDownStream& stream, std::string& token)
 {
     // key word is encountered, flush what is being processed, and have those keyword
     // handled by ParseBlock()
@@ -229,9 +229,7 @@ void EmphasisParser::CaptureCurrentCollectedStringAsRegularToken(std::string& cu
         return;
     }
 
-    std::shared_ptr<MarkDownHtmlGenerator> codeGen = std::make_shared<MarkDownStringHtmlGenerator>(currentToken);
-
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens({MarkDownHtmlGenerator::TokenType::String, std::move(currentToken)});
 
     currentToken.clear();
 }
@@ -297,21 +295,11 @@ bool EmphasisParser::TryCapturingRightEmphasisToken(const int ch, std::string& c
 {
     if (IsRightEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen = nullptr;
-        // right emphasis can be also left emphasis
-        if (IsLeftEmphasisDelimiter(ch))
-        {
-            // since it is both left and right emphasis, create one accordingly
-            codeGen = std::make_shared<MarkDownLeftAndRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-        }
-        else
-        {
-            codeGen = std::make_shared<MarkDownRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-        }
+        // right emphasis can be also left emphasis, if it is both left and right emphasis, create one accordingly
+        const auto tokenType = IsLeftEmphasisDelimiter(ch) ? MarkDownHtmlGenerator::TokenType::LeftAndRightEmphasis :
+                                                             MarkDownHtmlGenerator::TokenType::RightEmphasis;
 
-        m_parsedResult.AppendToLookUpTable(codeGen);
-
-        m_parsedResult.AppendToTokens(codeGen);
+        m_parsedResult.AppendToTokensAndLookUpTable({tokenType, std::move(currentToken), m_delimiterCnts, m_currentDelimiterType});
 
         currentToken.clear();
 
@@ -325,12 +313,8 @@ bool EmphasisParser::TryCapturingLeftEmphasisToken(const int ch, std::string& cu
     // left emphasis detected, save emphasis for later reference
     if (IsLeftEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen =
-            std::make_shared<MarkDownLeftEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-
-        m_parsedResult.AppendToLookUpTable(codeGen);
-
-        m_parsedResult.AppendToTokens(codeGen);
+        m_parsedResult.AppendToTokensAndLookUpTable(
+            {MarkDownHtmlGenerator::TokenType::LeftEmphasis, std::move(currentToken), m_delimiterCnts, m_currentDelimiterType});
 
         currentToken.clear();
         return true;
@@ -366,7 +350,7 @@ void EmphasisParser::CaptureEmphasisToken(const int ch, std::string& currentToke
     }
 }
 
-void LinkParser::Match(std::stringstream& stream)
+void LinkParser::Match(MarkDownStream& stream)
 {
     // link syntax check, match keyword at each stage
     bool capturedLink = (MatchAtLinkInit(stream) && MatchAtLinkTextRun(stream) && MatchAtLinkTextEnd(stream));
@@ -378,7 +362,7 @@ void LinkParser::Match(std::stringstream& stream)
 }
 
 // link is in form of [txt](url), this method matches '['
-bool LinkParser::MatchAtLinkInit(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkInit(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == '[')
     {
@@ -394,7 +378,7 @@ bool LinkParser::MatchAtLinkInit(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches txt
-bool LinkParser::MatchAtLinkTextRun(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkTextRun(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == ']')
     {
@@ -432,7 +416,7 @@ bool LinkParser::MatchAtLinkTextRun(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches ']'
-bool LinkParser::MatchAtLinkTextEnd(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkTextEnd(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == '(')
     {
@@ -448,7 +432,7 @@ bool LinkParser::MatchAtLinkTextEnd(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches '('
-bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkDestinationStart(MarkDownStream& lookahead)
 {
     // handles [xx](
     if (lookahead.peek() < 0)
@@ -481,7 +465,14 @@ bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
         ++i;
     }
     lookahead.clear();
-    lookahead.seekg(m_parsingCurrentPos, std::ios::beg);
+    lookahead.seekg(m_parsingCurrentPos);
+
+    // the destination never closes, e.g. [xx](yy, syntax check failed
+    if (m_linkDestinationStart > 0)
+    {
+        m_parsedResult.AppendParseResult(m_linkTextParsedResult);
+        return false;
+    }
 
     // control key is detected, syntax check failed
     if (MarkDownBlockParser::IsCntrl(lookahead.peek()))
@@ -493,7 +484,7 @@ bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
     return true;
 }
 // link is in form of [txt](url), this method matches ')'
-bool LinkParser::MatchAtLinkDestinationRun(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkDestinationRun(MarkDownStream& lookahead)
 {
     if (lookahead.peek() > 0 &&
         (MarkDownBlockParser::IsSpace(lookahead.peek()) || MarkDownBlockParser::IsCntrl(lookahead.peek())))
@@ -516,7 +507,7 @@ bool LinkParser::MatchAtLinkDestinationRun(std::stringstream& lookahead)
         {
             ParseBlock(lookahead);
         }
-        m_parsingCurrentPos = int(lookahead.tellg());
+        m_parsingCurrentPos = lookahead.tellg();
     }
 
     m_parsedResult.PopBack();
@@ -526,16 +517,14 @@ bool LinkParser::MatchAtLinkDestinationRun(std::stringstream& lookahead)
 
 // this method is called when link syntax check is complete
 // it processes the parsed result from link destination  and link text
-// and build a MarkDownStringHtmlGenerator that will output
+// and build a link token that will output
 // string in link syntax (text)[destination) will converts to
 // <a href=\destination\>text</a>
 void LinkParser::CaptureLinkToken()
 {
-    std::ostringstream html;
-    html << "<a href=\"";
     // process link destination
-    html << m_parsedResult.GenerateHtmlString();
-    html << "\">";
+    std::string destination;
+    m_parsedResult.GenerateHtmlString(destination);
 
     // when syntax check is complete, we have seen
     // '[', ']', '(', these keywords are not
@@ -549,23 +538,17 @@ void LinkParser::CaptureLinkToken()
     // translate what is captured in text of link
     // emphasis are processed here
     m_linkTextParsedResult.Translate();
-    html << m_linkTextParsedResult.GenerateHtmlString();
-    html << "</a>";
-
-    std::string html_string = html.str();
-
-    // Generate a MarkDownStringHtmlGenerator object
-    const std::shared_ptr<MarkDownHtmlGenerator> codeGen = std::make_shared<MarkDownStringHtmlGenerator>(html_string);
 
     m_parsedResult.Clear();
     m_parsedResult.FoundHtmlTags();
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens(
+        {MarkDownHtmlGenerator::TokenType::Link, std::move(destination), m_linkTextParsedResult.TakeTokens()});
     m_parsedResult.SetIsCaptured(true);
 }
 
 // list marker have form of ^-\s+ or \r-\s+
 // this method matches -\s
-bool ListParser::MatchNewListItem(std::stringstream& stream)
+bool ListParser::MatchNewListItem(MarkDownStream& stream)
 {
     const int ch = stream.peek();
     if (IsHyphen(ch) || IsPlus(ch) || IsAsterisk(ch))
@@ -587,7 +570,7 @@ bool ListParser::MatchNewListItem(std::stringstream& stream)
 // before calling this method
 // this method will return true, after it mataches new line char
 // at least once.
-bool ListParser::MatchNewBlock(std::stringstream& stream)
+bool ListParser::MatchNewBlock(MarkDownStream& stream)
 {
     if (IsNewLine(stream.peek()))
     {
@@ -604,7 +587,7 @@ bool ListParser::MatchNewBlock(std::stringstream& stream)
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
 // this method matches \d+\.
-bool ListParser::MatchNewOrderedListItem(std::stringstream& stream, std::string& number_string)
+bool ListParser::MatchNewOrderedListItem(MarkDownStream& stream, std::string& number_string)
 {
     do
     {
@@ -626,7 +609,7 @@ bool ListParser::MatchNewOrderedListItem(std::stringstream& stream, std::string&
 // parse blocks that wasn't captured
 // if what we encounter is one of following items, start of new list, list item, or new block element,
 // we do not include in the current block, we return, and have it handled by the caller
-void ListParser::ParseSubBlocks(std::stringstream& stream)
+void ListParser::ParseSubBlocks(MarkDownStream& stream)
 {
     while (!stream.eof())
     {
@@ -644,7 +627,7 @@ void ListParser::ParseSubBlocks(std::stringstream& stream)
                 }
                 else
                 {
-                    m_parsedResult.AddNewTokenToParsedResult(number_string);
+                    m_parsedResult.AddNewTokenToParsedResult(std::move(number_string));
                 }
             }
             else if (MatchNewListItem(stream) || MatchNewBlock(stream))
@@ -658,7 +641,7 @@ void ListParser::ParseSubBlocks(std::stringstream& stream)
     }
 }
 
-bool ListParser::CompleteListParsing(std::stringstream& stream)
+bool ListParser::CompleteListParsing(MarkDownStream& stream)
 {
     // check for - of -\s+ list marker
     if (stream.peek() == ' ')
@@ -681,7 +664,7 @@ bool ListParser::CompleteListParsing(std::stringstream& stream)
 }
 
 // list marker has a form of ^-\s+ or [\r, \n]-\s+, and this method checks the syntax
-void ListParser::Match(std::stringstream& stream)
+void ListParser::Match(MarkDownStream& stream)
 {
     // check for - of -\s+ list marker
     const int ch = stream.peek();
@@ -697,8 +680,8 @@ void ListParser::Match(std::stringstream& stream)
             // if it was asterisk, put the char back and start emphasis parsing
             if (IsAsterisk(ch))
             {
-                // ch is '*', it's safe to cast and put back
-                stream.putback(static_cast<unsigned char>(ch));
+                // ch is '*', put it back
+                stream.unget();
 
                 ParseTextAndEmphasis(stream);
             }
@@ -713,24 +696,15 @@ void ListParser::Match(std::stringstream& stream)
 
 void ListParser::CaptureListToken()
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    std::string const htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
 
-    std::string html_string = html.str();
-    std::shared_ptr<MarkDownListHtmlGenerator> const codeGen = std::make_shared<MarkDownListHtmlGenerator>(html_string);
-
-    m_parsedResult.Clear();
+    std::vector<MarkDownHtmlGenerator> listItem = m_parsedResult.TakeTokens();
     m_parsedResult.FoundHtmlTags();
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens({MarkDownHtmlGenerator::TokenType::UnorderedList, {}, std::move(listItem)});
 }
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
-void OrderedListParser::Match(std::stringstream& stream)
+void OrderedListParser::Match(MarkDownStream& stream)
 {
     // used to capture digit char
     std::string number_string = "";
@@ -754,32 +728,22 @@ void OrderedListParser::Match(std::stringstream& stream)
             else
             {
                 number_string += '.';
-                m_parsedResult.AddNewTokenToParsedResult(number_string);
+                m_parsedResult.AddNewTokenToParsedResult(std::move(number_string));
             }
         }
         else
         {
             // if incorrect syntax, capture as a new token.
-            m_parsedResult.AddNewTokenToParsedResult(number_string);
+            m_parsedResult.AddNewTokenToParsedResult(std::move(number_string));
         }
     }
 }
 
 void OrderedListParser::CaptureOrderedListToken(std::string& number_string)
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    const std::string htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
 
-    std::string html_string = html.str();
-    const std::shared_ptr<MarkDownOrderedListHtmlGenerator> codeGen =
-        std::make_shared<MarkDownOrderedListHtmlGenerator>(html_string, number_string);
-
-    m_parsedResult.Clear();
+    std::vector<MarkDownHtmlGenerator> listItem = m_parsedResult.TakeTokens();
     m_parsedResult.FoundHtmlTags();
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens({MarkDownHtmlGenerator::TokenType::OrderedList, std::move(number_string), std::move(listItem)});
 }
@@ -2,21 +2,124 @@
 // Licensed under the MIT License.
 #pragma once
 #include "MarkDownHtmlGenerator.h"
-#include <iomanip>
 #include "BaseCardElement.h"
 #include "MarkDownParsedResult.h"
 
 namespace AdaptiveCards
 {
+// Reads markdown text one char at a time. The parsers were written against std::stringstream, so it follows
+// the same rules for the calls they make: peek() and get() return EOF and set eof() once they run off the end,
+// tellg() returns -1 after that, and unget() and seekg() clear eof(). It only keeps a view of the text and an
+// offset, so it costs nothing to make and each call is a bounds check rather than a trip through the stream buffer.
+class MarkDownStream
+{
+public:
+    MarkDownStream(std::string_view text) : m_text(text){};
+
+    int peek()
+    {
+        if (!good())
+        {
+            m_fail = true;
+            return EOF;
+        }
+        if (m_pos == m_text.size())
+        {
+            m_eof = true;
+            return EOF;
+        }
+        return static_cast<unsigned char>(m_text[m_pos]);
+    }
+
+    int get()
+    {
+        if (!good())
+        {
+            m_fail = true;
+            return EOF;
+        }
+        if (m_pos == m_text.size())
+        {
+            m_eof = true;
+            m_fail = true;
+            return EOF;
+        }
+        return static_cast<unsigned char>(m_text[m_pos++]);
+    }
+
+    void get(char& ch)
+    {
+        const int next = get();
+        if (next != EOF)
+        {
+            ch = static_cast<char>(next);
+        }
+    }
+
+    void unget()
+    {
+        m_eof = false;
+        if (m_fail || m_pos == 0)
+        {
+            m_fail = true;
+            return;
+        }
+        --m_pos;
+    }
+
+    std::ptrdiff_t tellg()
+    {
+        if (!good())
+        {
+            m_fail = true;
+            return -1;
+        }
+        return static_cast<std::ptrdiff_t>(m_pos);
+    }
+
+    void seekg(std::ptrdiff_t pos)
+    {
+        m_eof = false;
+        if (m_fail || pos < 0 || static_cast<size_t>(pos) > m_text.size())
+        {
+            m_fail = true;
+            return;
+        }
+        m_pos = static_cast<size_t>(pos);
+    }
+
+    void clear()
+    {
+        m_eof = false;
+        m_fail = false;
+    }
+
+    bool eof() const
+    {
+        return m_eof;
+    }
+
+private:
+    bool good() const
+    {
+        return !m_eof && !m_fail;
+    }
+
+    std::string_view m_text;
+    size_t m_pos = 0;
+    bool m_eof = false;
+    bool m_fail = false;
+};
+
 class MarkDownBlockParser
 {
 public:
     MarkDownBlockParser(){};
     // Matches each MarkDown's Syntax Form
     // For each match, stream moves to the next char
-    virtual void Match(std::stringstream&) = 0;
+    virtual void Match(MarkDownStream&) = 0;
     // Parses Block
-    void ParseBlock(std::stringstream&);
+    void ParseBlock(MarkDownStream&);
     // Returns Parse result
     MarkDownParsedResult& GetParsedResult()
     {
@@ -51,7 +154,7 @@ protected:
         return (ch > 0) && isdigit(ch);
     }
 
-    void ParseTextAndEmphasis(std::stringstream& stream);
+    void ParseTextAndEmphasis(MarkDownStream& stream);
 
     // Holds parsed results
     MarkDownParsedResult m_parsedResult;
@@ -74,7 +177,7 @@ public:
         Captured  // Emphasis parsing is complete
     };
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
     // Captures remaining charaters in given token and causes the emphasis parsing to terminate
     void Flush(const int ch, std::string& currentToken);
@@ -107,13 +210,11 @@ public:
         return (ch == '*') ? DelimiterType::Asterisk : DelimiterType::Underscore;
     };
 
-    typedef EmphasisState (*MatchWithChar)(EmphasisParser&, std::stringstream&, std::string&);
-
     // Callback function that handles the Text State
-    static EmphasisState MatchText(EmphasisParser&, std::stringstream&, std::string&);
+    static EmphasisState MatchText(EmphasisParser&, MarkDownStream&, std::string&);
 
     // Callback function that handles the Emphasis State
-    static EmphasisState MatchEmphasis(EmphasisParser&, std::stringstream&, std::string&);
+    static EmphasisState MatchEmphasis(EmphasisParser&, MarkDownStream&, std::string&);
 
     static bool IsEmphasisToken(int token);
 
@@ -125,10 +226,6 @@ protected:
     DelimiterType m_currentDelimiterType = DelimiterType::Init;
     EmphasisState m_current_state = EmphasisState::Text;
 
-    // vector of callback functions that handles state transistions
-    const std::unordered_map<EmphasisState, MatchWithChar> m_stateMachine = {
-        {EmphasisState::Text, MatchText}, {EmphasisState::Emphasis, MatchEmphasis}};
-
     // holds currently collected token
     std::string m_current_token;
 };
@@ -143,25 +240,25 @@ public:
     LinkParser& operator=(LinkParser&&) = default;
     virtual ~LinkParser() = default;
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
 private:
     void CaptureLinkToken();
 
     // Matches Initial syntax of link
-    bool MatchAtLinkInit(std::stringstream&);
+    bool MatchAtLinkInit(MarkDownStream&);
     // Matches LinkText Run syntax of link
-    bool MatchAtLinkTextRun(std::stringstream&);
+    bool MatchAtLinkTextRun(MarkDownStream&);
     // Matches LinkText End syntax of link
-    bool MatchAtLinkTextEnd(std::stringstream&);
+    bool MatchAtLinkTextEnd(MarkDownStream&);
     // Matches LinkDestination Start syntax of link
-    bool MatchAtLinkDestinationStart(std::stringstream&);
+    bool MatchAtLinkDestinationStart(MarkDownStream&);
     // Matches LinkDestination Run syntax of link
-    bool MatchAtLinkDestinationRun(std::stringstream&);
+    bool MatchAtLinkDestinationRun(MarkDownStream&);
 
     int m_linkDestinationStart = 0;
     int m_linkDestinationEnd = 0;
-    std::stringstream::pos_type m_parsingCurrentPos = 0;
+    std::ptrdiff_t m_parsingCurrentPos = 0;
 
     // holds intermediate result of LinkText
     MarkDownParsedResult m_linkTextParsedResult;
@@ -177,10 +274,10 @@ public:
     ListParser& operator=(ListParser&&) = default;
     virtual ~ListParser() = default;
 
-    void Match(std::stringstream&) override;
-    bool MatchNewListItem(std::stringstream&);
-    bool MatchNewBlock(std::stringstream&);
-    bool MatchNewOrderedListItem(std::stringstream&, std::string&);
+    void Match(MarkDownStream&) override;
+    bool MatchNewListItem(MarkDownStream&);
+    bool MatchNewBlock(MarkDownStream&);
+    bool MatchNewOrderedListItem(MarkDownStream&, std::string&);
     static constexpr bool IsHyphen(const int ch)
     {
         return ch == '-';
@@ -203,8 +300,8 @@ public:
     };
 
 protected:
-    void ParseSubBlocks(std::stringstream&);
-    bool CompleteListParsing(std::stringstream& stream);
+    void ParseSubBlocks(MarkDownStream&);
+    bool CompleteListParsing(MarkDownStream& stream);
 
 private:
     void CaptureListToken();
@@ -220,7 +317,7 @@ public:
     OrderedListParser& operator=(OrderedListParser&&) = default;
     ~OrderedListParser() = default;
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
 private:
     void CaptureOrderedListToken(std::string&);
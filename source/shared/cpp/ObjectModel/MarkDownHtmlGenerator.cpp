@@ -5,210 +5,376 @@
 
 using namespace AdaptiveCards;
 
-std::string MarkDownStringHtmlGenerator::GenerateHtmlString()
+namespace
 {
-    if (m_isHead)
-    {
-        m_token = "<p>" + m_token;
-    }
-
-    if (m_isTail)
-    {
-        return m_token + "</p>";
-    }
-
-    return m_token;
-}
-
-//     left and right emphasis tokens are match if
-//     1. they are same types
-//     2. neither of the emphasis tokens are both left and right emphasis tokens, and
-//        if either or both of them are, then their sum is not multiple of 3
-bool MarkDownEmphasisHtmlGenerator::IsMatch(const MarkDownEmphasisHtmlGenerator& emphasisToken)
+constexpr std::string_view TagToHtml(char tag)
 {
-    if (this->type == emphasisToken.type)
+    switch (tag)
     {
-        // rule #9 & #10, sum of delimiter count can't be multiple of 3
-        return !(
-            (this->IsLeftAndRightEmphasis() || emphasisToken.IsLeftAndRightEmphasis()) &&
-            (((this->m_numberOfUnusedDelimiters + emphasisToken.m_numberOfUnusedDelimiters) % 3) == 0));
+    case 'i':
+        return "<em>";
+    case 'I':
+        return "</em>";
+    case 'b':
+        return "<strong>";
+    default:
+        return "</strong>";
     }
-    return false;
 }
 
-bool MarkDownEmphasisHtmlGenerator::IsSameType(const MarkDownEmphasisHtmlGenerator& token)
+// appends text with the entities MarkDownParser escaped turned back into the chars they stand for
+void AppendDecodedText(std::string_view escapedText, std::string& text)
 {
-    return this->type == token.type;
-}
+    static constexpr std::pair<std::string_view, char> entities[] = {{"&lt;", '<'}, {"&gt;", '>'}, {"&quot;", '"'}, {"&amp;", '&'}};
 
-// adjust number of emphasis counts after maching is done
-int MarkDownEmphasisHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken)
-{
-    int delimiterCount = 0;
-    if (leftOver >= 0)
+    size_t begin = 0;
+    for (size_t ampersand = escapedText.find('&'); ampersand != std::string_view::npos;
+         ampersand = escapedText.find('&', begin))
     {
-        delimiterCount = this->m_numberOfUnusedDelimiters - leftOver;
-        this->m_numberOfUnusedDelimiters = leftOver;
-        rightToken.m_numberOfUnusedDelimiters = 0;
-    }
-    else
-    {
-        delimiterCount = this->m_numberOfUnusedDelimiters;
-        rightToken.m_numberOfUnusedDelimiters = leftOver * (-1);
-        this->m_numberOfUnusedDelimiters = 0;
+        text.append(escapedText.substr(begin, ampersand - begin));
+
+        const auto entity = std::find_if(std::begin(entities), std::end(entities), [&](const auto& candidate) {
+            return escapedText.compare(ampersand, candidate.first.size(), candidate.first) == 0;
+        });
+        if (entity != std::end(entities))
+        {
+            text += entity->second;
+            begin = ampersand + entity->first.size();
+        }
+        else
+        {
+            text += '&';
+            begin = ampersand + 1;
+        }
     }
-    return delimiterCount;
+    text.append(escapedText.substr(begin));
 }
+} // namespace
 
-// generate bold and emphasis html tags
-bool MarkDownEmphasisHtmlGenerator::GenerateTags(MarkDownEmphasisHtmlGenerator& token)
+void MarkDownTextRunBuilder::AddText(std::string_view escapedText)
 {
-    int delimiterCount = 0, leftOver = 0;
-    leftOver = this->m_numberOfUnusedDelimiters - token.m_numberOfUnusedDelimiters;
-    delimiterCount = this->AdjustEmphasisCounts(leftOver, token);
-    const bool hasHtmlTags = (delimiterCount > 0);
-
-    // emphasis found
-    if (delimiterCount % 2)
+    if (escapedText.empty())
     {
-        this->PushItalicTag();
-        token.PushItalicTag();
+        return;
     }
 
-    // strong emphasis found
-    for (int i = 0; i < delimiterCount / 2; i++)
+    const bool isBold = m_boldDepth > 0;
+    const bool isItalic = m_italicDepth > 0;
+    if (m_runs->empty() || m_runs->back().isBold != isBold || m_runs->back().isItalic != isItalic ||
+        m_runs->back().linkUrl != m_linkUrl)
     {
-        this->PushBoldTag();
-        token.PushBoldTag();
+        m_runs->push_back({{}, isBold, isItalic, m_linkUrl});
     }
-    return hasHtmlTags;
+    AppendDecodedText(escapedText, m_runs->back().text);
 }
 
-void MarkDownEmphasisHtmlGenerator::PushItalicTag()
+void MarkDownTextRunBuilder::ApplyTag(char tag)
 {
-    m_tags.push_back("<em>");
+    switch (tag)
+    {
+    case 'i':
+        ++m_italicDepth;
+        break;
+    case 'I':
+        m_italicDepth = std::max(m_italicDepth - 1, 0);
+        break;
+    case 'b':
+        ++m_boldDepth;
+        break;
+    default:
+        m_boldDepth = std::max(m_boldDepth - 1, 0);
+        break;
+    }
 }
 
-void MarkDownEmphasisHtmlGenerator::PushBoldTag()
+void MarkDownTextRunBuilder::BeginLink(std::string_view escapedUrl)
 {
-    m_tags.push_back("<strong>");
+    m_linkUrl.clear();
+    AppendDecodedText(escapedUrl, m_linkUrl);
 }
 
-std::string MarkDownLeftEmphasisHtmlGenerator::GenerateHtmlString()
+void MarkDownHtmlGenerator::GenerateHtmlString(std::string& html) const
 {
-    if (m_isHead)
+    switch (m_tokenType)
+    {
+    case TokenType::LeftEmphasis:
     {
-        html << "<p>";
+        if (m_isHead)
+        {
+            html += "<p>";
+        }
+
+        if (m_numberOfUnusedDelimiters)
+        {
+            const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
+            html.append(m_token, startIdx, std::string::npos);
+        }
+
+        // append tags; since left delims, append it in the reverse order
+        for (auto itr = m_tags.rbegin(); itr != m_tags.rend(); ++itr)
+        {
+            html += TagToHtml(*itr);
+        }
+        break;
     }
-
-    if (m_numberOfUnusedDelimiters)
+    case TokenType::RightEmphasis:
+    case TokenType::LeftAndRightEmphasis:
     {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
+        if (m_isHead)
+        {
+            html += "<p>";
+        }
+
+        // append tags;
+        for (const char tag : m_tags)
+        {
+            html += TagToHtml(tag);
+        }
+
+        // if there are unused emphasis, append them
+        if (m_numberOfUnusedDelimiters)
+        {
+            const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
+            html.append(m_token, startIdx, std::string::npos);
+        }
+        break;
     }
-
-    // append tags; since left delims, append it in the reverse order
-    for (auto itr = m_tags.rbegin(); itr != m_tags.rend(); ++itr)
+    case TokenType::Link:
     {
-        html << *itr;
+        if (m_isHead)
+        {
+            html += "<p>";
+        }
+        html += "<a href=\"";
+        html += m_token;
+        html += "\">";
+        for (const auto& child : m_children)
+        {
+            child.GenerateHtmlString(html);
+        }
+        html += "</a>";
+        break;
+    }
+    case TokenType::UnorderedList:
+    case TokenType::OrderedList:
+    {
+        const bool isOrdered = (m_tokenType == TokenType::OrderedList);
+        if (m_isHead)
+        {
+            if (isOrdered)
+            {
+                html += "<ol start=\"";
+                html += m_token;
+                html += "\">";
+            }
+            else
+            {
+                html += "<ul>";
+            }
+        }
+        html += "<li>";
+        for (const auto& child : m_children)
+        {
+            child.GenerateHtmlString(html);
+        }
+        html += "</li>";
+        if (m_isTail)
+        {
+            html += isOrdered ? "</ol>" : "</ul>";
+        }
+        return;
+    }
+    default:
+    {
+        if (m_isHead)
+        {
+            html += "<p>";
+        }
+        html += m_token;
+        break;
+    }
     }
 
     if (m_isTail)
     {
-        return html.str() + "</p>";
+        html += "</p>";
     }
-
-    return html.str();
-}
-
-void MarkDownRightEmphasisHtmlGenerator::PushItalicTag()
-{
-    m_tags.push_back("</em>");
 }
 
-void MarkDownRightEmphasisHtmlGenerator::PushBoldTag()
+// same as GenerateHtmlString, but the tags change the style of the runs rather than being written out.
+// block tags are left to MarkDownParsedResult::GenerateBlocks, lists nested in a list item or link text
+// are flattened into its runs
+void MarkDownHtmlGenerator::GenerateTextRuns(MarkDownTextRunBuilder& builder) const
 {
-    m_tags.push_back("</strong>");
-}
-
-std::string MarkDownRightEmphasisHtmlGenerator::GenerateHtmlString()
-{
-    if (m_isHead)
+    switch (m_tokenType)
+    {
+    case TokenType::LeftEmphasis:
     {
-        html << "<p>";
+        if (m_numberOfUnusedDelimiters)
+        {
+            builder.AddText(std::string_view(m_token).substr(m_token.size() - m_numberOfUnusedDelimiters));
+        }
+
+        for (auto itr = m_tags.rbegin(); itr != m_tags.rend(); ++itr)
+        {
+            builder.ApplyTag(*itr);
+        }
+        break;
     }
-
-    // append tags;
-    for (auto itr = m_tags.begin(); itr != m_tags.end(); ++itr)
+    case TokenType::RightEmphasis:
+    case TokenType::LeftAndRightEmphasis:
     {
-        html << *itr;
+        for (const char tag : m_tags)
+        {
+            builder.ApplyTag(tag);
+        }
+
+        if (m_numberOfUnusedDelimiters)
+        {
+            builder.AddText(std::string_view(m_token).substr(m_token.size() - m_numberOfUnusedDelimiters));
+        }
+        break;
     }
-
-    // if there are unused emphasis, append them
-    if (m_numberOfUnusedDelimiters)
+    case TokenType::Link:
     {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
+        builder.BeginLink(m_token);
+        for (const auto& child : m_children)
+        {
+            child.GenerateTextRuns(builder);
+        }
+        builder.EndLink();
+        break;
     }
-
-    if (m_isTail)
+    case TokenType::UnorderedList:
+    case TokenType::OrderedList:
     {
-        return html.str() + "</p>";
+        for (const auto& child : m_children)
+        {
+            child.GenerateTextRuns(builder);
+        }
+        break;
+    }
+    default:
+        builder.AddText(m_token);
+        break;
     }
-
-    return html.str();
 }
 
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushItalicTag()
+MarkDownBlock MarkDownHtmlGenerator::CreateBlock() const
 {
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<em>");
-    }
-    else
+    MarkDownBlock block;
+    switch (m_tokenType)
     {
-        m_tags.push_back("</em>");
+    case TokenType::UnorderedList:
+        block.type = MarkDownBlock::BlockType::UnorderedList;
+        break;
+    case TokenType::OrderedList:
+        block.type = MarkDownBlock::BlockType::OrderedList;
+        block.start = m_token;
+        break;
+    default:
+        block.type = MarkDownBlock::BlockType::Paragraph;
+        break;
     }
+    return block;
 }
 
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushBoldTag()
+MarkDownHtmlGenerator::MarkDownBlockType MarkDownHtmlGenerator::GetBlockType() const
 {
-    if (m_directionType == Left)
+    switch (m_tokenType)
     {
-        m_tags.push_back("<strong>");
+    case TokenType::UnorderedList:
+        return UnorderedList;
+    case TokenType::OrderedList:
+        return OrderedList;
+    default:
+        return ContainerBlock;
     }
-    else
+}
+
+bool MarkDownHtmlGenerator::IsRightEmphasis() const
+{
+    return m_tokenType == TokenType::RightEmphasis ||
+           (m_tokenType == TokenType::LeftAndRightEmphasis && m_directionType == Right);
+}
+
+bool MarkDownHtmlGenerator::IsLeftEmphasis() const
+{
+    return m_tokenType == TokenType::LeftEmphasis ||
+           (m_tokenType == TokenType::LeftAndRightEmphasis && m_directionType == Left);
+}
+
+//     left and right emphasis tokens are match if
+//     1. they are same types
+//     2. neither of the emphasis tokens are both left and right emphasis tokens, and
+//        if either or both of them are, then their sum is not multiple of 3
+bool MarkDownHtmlGenerator::IsMatch(const MarkDownHtmlGenerator& emphasisToken) const
+{
+    if (this->type == emphasisToken.type)
     {
-        m_tags.push_back("</strong>");
+        // rule #9 & #10, sum of delimiter count can't be multiple of 3
+        return !(
+            (this->IsLeftAndRightEmphasis() || emphasisToken.IsLeftAndRightEmphasis()) &&
+            (((this->m_numberOfUnusedDelimiters + emphasisToken.m_numberOfUnusedDelimiters) % 3) == 0));
     }
+    return false;
+}
+
+bool MarkDownHtmlGenerator::IsSameType(const MarkDownHtmlGenerator& token) const
+{
+    return this->type == token.type;
 }
 
-std::string MarkDownListHtmlGenerator::GenerateHtmlString()
+// adjust number of emphasis counts after maching is done
+int MarkDownHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownHtmlGenerator& rightToken)
 {
-    if (m_isHead)
+    int delimiterCount = 0;
+    if (leftOver >= 0)
     {
-        m_token = "<ul>" + m_token;
+        delimiterCount = this->m_numberOfUnusedDelimiters - leftOver;
+        this->m_numberOfUnusedDelimiters = leftOver;
+        rightToken.m_numberOfUnusedDelimiters = 0;
     }
-
-    if (m_isTail)
+    else
     {
-        return m_token + "</ul>";
+        delimiterCount = this->m_numberOfUnusedDelimiters;
+        rightToken.m_numberOfUnusedDelimiters = leftOver * (-1);
+        this->m_numberOfUnusedDelimiters = 0;
     }
-
-    return m_token;
+    return delimiterCount;
 }
 
-std::string MarkDownOrderedListHtmlGenerator::GenerateHtmlString()
+// generate bold and emphasis html tags
+bool MarkDownHtmlGenerator::GenerateTags(MarkDownHtmlGenerator& token)
 {
-    if (m_isHead)
+    int delimiterCount = 0, leftOver = 0;
+    leftOver = this->m_numberOfUnusedDelimiters - token.m_numberOfUnusedDelimiters;
+    delimiterCount = this->AdjustEmphasisCounts(leftOver, token);
+    const bool hasHtmlTags = (delimiterCount > 0);
+
+    // emphasis found
+    if (delimiterCount % 2)
     {
-        m_token = "<ol start=\"" + m_numberString + "\">" + m_token;
+        this->PushItalicTag();
+        token.PushItalicTag();
     }
 
-    if (m_isTail)
+    // strong emphasis found
+    for (int i = 0; i < delimiterCount / 2; i++)
     {
-        return m_token + "</ol>";
+        this->PushBoldTag();
+        token.PushBoldTag();
     }
+    return hasHtmlTags;
+}
 
-    return m_token;
+// left emphasis opens tags and right emphasis closes them
+void MarkDownHtmlGenerator::PushItalicTag()
+{
+    m_tags.push_back(IsLeftEmphasis() ? 'i' : 'I');
+}
+
+void MarkDownHtmlGenerator::PushBoldTag()
+{
+    m_tags.push_back(IsLeftEmphasis() ? 'b' : 'B');
 }
@@ -2,9 +2,7 @@
 // Licensed under the MIT License.
 #pragma once
 #include <string>
-#include <iomanip>
 #include <vector>
-#include <list>
 #include "BaseCardElement.h"
 
 namespace AdaptiveCards
@@ -20,132 +18,140 @@ enum class DelimiterType
     Asterisk
 };
 
-// this class knows how to generate html string of their types
-// - MarkDownStringHtmlGenerator
-//   it is the most basic form,
-//   it simply retains and return text as string
-// - MarkDownEmphasisHtmlGenerator
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-// - MarkDownListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   MarkDownBlockType, this is used in generating html block tags
-//   list uses block tag of <ul> all others use <p>
-class MarkDownHtmlGenerator
+// a run of text with the same style, as MarkDownParser::TransformToBlocks returns it.
+// html entities the parser escaped are decoded again
+struct MarkDownTextRun
 {
-public:
-    MarkDownHtmlGenerator(const MarkDownHtmlGenerator&) = delete;
-    MarkDownHtmlGenerator(MarkDownHtmlGenerator&&) = delete;
-    MarkDownHtmlGenerator& operator=(const MarkDownHtmlGenerator&) = delete;
-    MarkDownHtmlGenerator& operator=(MarkDownHtmlGenerator&&) = delete;
-    virtual ~MarkDownHtmlGenerator() = default;
+    std::string text;
+    bool isBold = false;
+    bool isItalic = false;
+    // url of the link the text is in, empty when it isn't in one
+    std::string linkUrl;
+};
 
-    enum MarkDownBlockType
+// a paragraph or a list, as MarkDownParser::TransformToBlocks returns it
+struct MarkDownBlock
+{
+    enum class BlockType
     {
-        ContainerBlock,
+        Paragraph,
         UnorderedList,
         OrderedList
     };
 
-    MarkDownHtmlGenerator() : m_token(""){};
-    MarkDownHtmlGenerator(std::string& token) : m_token(token){};
-    void MakeItHead()
-    {
-        m_isHead = true;
-    }
-    void MakeItTail()
+    BlockType type = BlockType::Paragraph;
+    // the number an ordered list starts at, as it was written
+    std::string start;
+    // text of each list item; a paragraph has exactly one
+    std::vector<std::vector<MarkDownTextRun>> items;
+};
+
+// collects text runs from tokens, keeping track of the emphasis tags and the link the text is in
+class MarkDownTextRunBuilder
+{
+public:
+    // text is added to runs until SetRuns is called again
+    void SetRuns(std::vector<MarkDownTextRun>& runs)
     {
-        m_isTail = true;
+        m_runs = &runs;
     }
-    virtual bool IsNewLine()
+    void AddText(std::string_view escapedText);
+    void ApplyTag(char tag);
+    void BeginLink(std::string_view escapedUrl);
+    void EndLink()
     {
-        return false;
+        m_linkUrl.clear();
     }
-    virtual std::string GenerateHtmlString() = 0;
-    virtual MarkDownBlockType GetBlockType() const
-    {
-        return ContainerBlock;
-    };
 
-protected:
-    std::string m_token;
-    std::ostringstream html;
-    bool m_isHead = false;
-    bool m_isTail = false;
+private:
+    std::vector<MarkDownTextRun>* m_runs = nullptr;
+    int m_boldDepth = 0;
+    int m_italicDepth = 0;
+    std::string m_linkUrl;
 };
 
-// - MarkDownStringHtmlGenerator
+// this class holds one parsed token and knows how to generate html string of its type.
+// tokens are plain values stored back to back in MarkDownParsedResult, so parsing doesn't
+// allocate a node per token
+// - String
 //   it is the most basic form,
 //   it simply retains and return text as string
-class MarkDownStringHtmlGenerator : public MarkDownHtmlGenerator
-{
-public:
-    MarkDownStringHtmlGenerator() = delete;
-    MarkDownStringHtmlGenerator(const MarkDownStringHtmlGenerator&) = delete;
-    MarkDownStringHtmlGenerator(MarkDownStringHtmlGenerator&&) = delete;
-    MarkDownStringHtmlGenerator& operator=(const MarkDownStringHtmlGenerator&) = delete;
-    MarkDownStringHtmlGenerator& operator=(MarkDownStringHtmlGenerator&&) = delete;
-    ~MarkDownStringHtmlGenerator() = default;
-
-    MarkDownStringHtmlGenerator(std::string& token) : MarkDownHtmlGenerator(token){};
-    std::string GenerateHtmlString() override;
-};
-
-// - MarkDownNewLineHtmlGenerator
+// - NewLine
 //   it contains new line chars
-class MarkDownNewLineHtmlGenerator : public MarkDownStringHtmlGenerator
+// - LeftEmphasis, RightEmphasis, LeftAndRightEmphasis
+//   it knows how to handle bold and italic html
+//   tags and apply those to its text when asked to generate html string
+//   left and right emphasis can have both directions, and its final direction is determined at the later stage
+// - Link
+//   it holds html of the link destination and tokens of the link text
+// - UnorderedList, OrderedList
+//   it holds tokens of one list item, its GetBlockType() returns
+//   UnorderedList or OrderedList, this is used in generating html block tags
+//   lists use block tags of <ul> and <ol> all others use <p>
+class MarkDownHtmlGenerator
 {
 public:
-    MarkDownNewLineHtmlGenerator() = delete;
-    MarkDownNewLineHtmlGenerator(const MarkDownNewLineHtmlGenerator&) = delete;
-    MarkDownNewLineHtmlGenerator(MarkDownNewLineHtmlGenerator&&) = delete;
-    MarkDownNewLineHtmlGenerator& operator=(const MarkDownNewLineHtmlGenerator&) = delete;
-    MarkDownNewLineHtmlGenerator& operator=(MarkDownNewLineHtmlGenerator&&) = delete;
-    ~MarkDownNewLineHtmlGenerator() = default;
+    enum MarkDownBlockType
+    {
+        ContainerBlock,
+        UnorderedList,
+        OrderedList
+    };
 
-    MarkDownNewLineHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-    bool IsNewLine() override
+    enum class TokenType
     {
-        return true;
-    }
-};
+        String,
+        NewLine,
+        LeftEmphasis,
+        RightEmphasis,
+        LeftAndRightEmphasis,
+        Link,
+        UnorderedList,
+        OrderedList
+    };
 
-// - MarkDownEmphasisHtmlGenerator
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-class MarkDownEmphasisHtmlGenerator : public MarkDownHtmlGenerator
-{
-public:
-    MarkDownEmphasisHtmlGenerator() = delete;
-    MarkDownEmphasisHtmlGenerator(const MarkDownEmphasisHtmlGenerator&) = delete;
-    MarkDownEmphasisHtmlGenerator(MarkDownEmphasisHtmlGenerator&&) = delete;
-    MarkDownEmphasisHtmlGenerator& operator=(const MarkDownEmphasisHtmlGenerator&) = delete;
-    MarkDownEmphasisHtmlGenerator& operator=(MarkDownEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownEmphasisHtmlGenerator() = default;
+    MarkDownHtmlGenerator(TokenType tokenType, std::string token) :
+        m_tokenType(tokenType), m_token(std::move(token)){};
 
-    MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type){};
+    MarkDownHtmlGenerator(TokenType tokenType, std::string token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
+        m_tokenType(tokenType), m_token(std::move(token)), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type){};
 
-    MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type, std::vector<std::string>& tags) :
-        MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type), m_tags(tags){};
+    // links keep their destination html as the token, ordered lists the number they start at
+    MarkDownHtmlGenerator(TokenType tokenType, std::string token, std::vector<MarkDownHtmlGenerator> children) :
+        m_tokenType(tokenType), m_token(std::move(token)), m_children(std::move(children)){};
 
-    virtual bool IsRightEmphasis() const
+    void MakeItHead()
     {
-        return false;
+        m_isHead = true;
     }
-    virtual bool IsLeftEmphasis() const
+    void MakeItTail()
     {
-        return false;
+        m_isTail = true;
     }
-    virtual bool IsLeftAndRightEmphasis() const
+    bool IsNewLine() const
     {
-        return false;
+        return m_tokenType == TokenType::NewLine;
     }
-    virtual void PushItalicTag();
-    virtual void PushBoldTag();
 
-    bool IsMatch(const MarkDownEmphasisHtmlGenerator& token);
-    bool IsSameType(const MarkDownEmphasisHtmlGenerator& token);
+    // appends html string of this token to html
+    void GenerateHtmlString(std::string& html) const;
+    // appends text of this token to the builder's runs
+    void GenerateTextRuns(MarkDownTextRunBuilder& builder) const;
+    MarkDownBlockType GetBlockType() const;
+    // a new block for this token to start, with no items yet
+    MarkDownBlock CreateBlock() const;
+
+    bool IsRightEmphasis() const;
+    bool IsLeftEmphasis() const;
+    bool IsLeftAndRightEmphasis() const
+    {
+        return m_tokenType == TokenType::LeftAndRightEmphasis;
+    }
+    void PushItalicTag();
+    void PushBoldTag();
+
+    bool IsMatch(const MarkDownHtmlGenerator& token) const;
+    bool IsSameType(const MarkDownHtmlGenerator& token) const;
     bool IsDone() const
     {
         return m_numberOfUnusedDelimiters == 0;
@@ -154,150 +160,34 @@ public:
     {
         return m_numberOfUnusedDelimiters;
     };
-    bool GenerateTags(MarkDownEmphasisHtmlGenerator& token);
+    bool GenerateTags(MarkDownHtmlGenerator& token);
     void ReverseDirectionType()
     {
         m_directionType = !m_directionType;
     };
 
-protected:
+private:
     enum
     {
         Left = 0,
         Right = 1,
     };
 
-    int AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken);
-    int m_numberOfUnusedDelimiters;
-    int m_directionType = Right;
-    DelimiterType type;
-    std::vector<std::string> m_tags;
-};
-
-// - MarkDownLeftEmphasisHtmlGenerator
-//   it knows how to generates opening italic and bold html tags
-class MarkDownLeftEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
-{
-public:
-    MarkDownLeftEmphasisHtmlGenerator() = delete;
-    MarkDownLeftEmphasisHtmlGenerator(const MarkDownLeftEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator(MarkDownLeftEmphasisHtmlGenerator&&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator& operator=(const MarkDownLeftEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator& operator=(MarkDownLeftEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownLeftEmphasisHtmlGenerator() = default;
-
-    MarkDownLeftEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-
-    MarkDownLeftEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type, std::vector<std::string>& tags) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type, tags){};
-
-    bool IsLeftEmphasis() const override
-    {
-        return true;
-    }
-    std::string GenerateHtmlString() override;
-};
-
-// - MarkDownRightEmphasisHtmlGenerator
-//   it knows how to generates closing italic and bold html tags
-class MarkDownRightEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
-{
-public:
-    MarkDownRightEmphasisHtmlGenerator() = delete;
-    MarkDownRightEmphasisHtmlGenerator(const MarkDownRightEmphasisHtmlGenerator&) = delete;
-    MarkDownRightEmphasisHtmlGenerator(MarkDownRightEmphasisHtmlGenerator&&) = delete;
-    MarkDownRightEmphasisHtmlGenerator& operator=(const MarkDownRightEmphasisHtmlGenerator&) = delete;
-    MarkDownRightEmphasisHtmlGenerator& operator=(MarkDownRightEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownRightEmphasisHtmlGenerator() = default;
-
-    MarkDownRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-
-    void GenerateTags(std::shared_ptr<MarkDownEmphasisHtmlGenerator>& token);
-    bool IsRightEmphasis() const override
-    {
-        return true;
-    }
-    std::string GenerateHtmlString() override;
-    void PushItalicTag() override;
-    void PushBoldTag() override;
-};
-
-// - MarkDownLeftAndRightEmphasisHtmlGenerator
-//   it can have both directions, and its final direction is determined at the later stage
-class MarkDownLeftAndRightEmphasisHtmlGenerator : public MarkDownRightEmphasisHtmlGenerator
-{
-public:
-    MarkDownLeftAndRightEmphasisHtmlGenerator() = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownLeftAndRightEmphasisHtmlGenerator() = default;
-
-    MarkDownLeftAndRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownRightEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-    bool IsRightEmphasis() const override
-    {
-        return m_directionType == Right;
-    }
-    bool IsLeftEmphasis() const override
-    {
-        return m_directionType == Left;
-    }
-    bool IsLeftAndRightEmphasis() const override
-    {
-        return true;
-    };
-    void PushItalicTag() override;
-    void PushBoldTag() override;
-};
-
-// - MarkDownListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   UnorderedList type, this is used in generating html block tags <ul>
-class MarkDownListHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownListHtmlGenerator() = delete;
-    MarkDownListHtmlGenerator(const MarkDownListHtmlGenerator&) = delete;
-    MarkDownListHtmlGenerator(MarkDownListHtmlGenerator&&) = delete;
-    MarkDownListHtmlGenerator& operator=(const MarkDownListHtmlGenerator&) = delete;
-    MarkDownListHtmlGenerator& operator=(MarkDownListHtmlGenerator&&) = delete;
-    ~MarkDownListHtmlGenerator() = default;
-
-    MarkDownListHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-    std::string GenerateHtmlString() override;
-    MarkDownBlockType GetBlockType() const override
-    {
-        return UnorderedList;
-    };
-};
+    int AdjustEmphasisCounts(int leftOver, MarkDownHtmlGenerator& rightToken);
 
-// - MarkDownUnorderedListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   OrderedList type, this is used in generating html block tags <ol>
-class MarkDownOrderedListHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownOrderedListHtmlGenerator() = delete;
-    MarkDownOrderedListHtmlGenerator(const MarkDownOrderedListHtmlGenerator&) = delete;
-    MarkDownOrderedListHtmlGenerator(MarkDownOrderedListHtmlGenerator&&) = delete;
-    MarkDownOrderedListHtmlGenerator& operator=(const MarkDownOrderedListHtmlGenerator&) = delete;
-    MarkDownOrderedListHtmlGenerator& operator=(MarkDownOrderedListHtmlGenerator&&) = delete;
-    ~MarkDownOrderedListHtmlGenerator() = default;
+    TokenType m_tokenType;
+    std::string m_token;
+    bool m_isHead = false;
+    bool m_isTail = false;
 
-    MarkDownOrderedListHtmlGenerator(std::string& token, std::string& number_string) :
-        MarkDownStringHtmlGenerator(token), m_numberString(number_string){};
-    std::string GenerateHtmlString() override;
-    MarkDownBlockType GetBlockType() const override
-    {
-        return OrderedList;
-    };
+    // emphasis only
+    int m_numberOfUnusedDelimiters = 0;
+    int m_directionType = Right;
+    DelimiterType type = DelimiterType::Init;
+    // one char per tag, in the order they were pushed: 'i' <em>, 'I' </em>, 'b' <strong>, 'B' </strong>
+    std::string m_tags;
 
-private:
-    std::string m_numberString;
+    // link text, or contents of a list item
+    std::vector<MarkDownHtmlGenerator> m_children;
 };
-
 } // namespace AdaptiveCards
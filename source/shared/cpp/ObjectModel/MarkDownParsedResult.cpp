@@ -13,25 +13,30 @@ void MarkDownParsedResult::Translate()
 // appends html block tags at head and tail of the list
 void MarkDownParsedResult::AddBlockTags()
 {
+    if (m_codeGenTokens.empty())
+    {
+        return;
+    }
+
     // Parsing is done, let code gen token know who is the head of the list
-    m_codeGenTokens.front()->MakeItHead();
+    m_codeGenTokens.front().MakeItHead();
 
     // Parsing is done, let code gen token know who is the tail of the list
-    m_codeGenTokens.back()->MakeItTail();
+    m_codeGenTokens.back().MakeItTail();
 }
 
 void MarkDownParsedResult::MarkTags(MarkDownHtmlGenerator& x)
 {
-    if (m_codeGenTokens.back()->GetBlockType() != x.GetBlockType())
+    if (m_codeGenTokens.back().GetBlockType() != x.GetBlockType())
     {
-        if (m_codeGenTokens.back()->IsNewLine())
+        if (m_codeGenTokens.back().IsNewLine())
         {
             m_codeGenTokens.pop_back();
         }
 
         if (!m_codeGenTokens.empty())
         {
-            m_codeGenTokens.back()->MakeItTail();
+            m_codeGenTokens.back().MakeItTail();
         }
         x.MakeItHead();
     }
@@ -39,41 +44,77 @@ void MarkDownParsedResult::MarkTags(MarkDownHtmlGenerator& x)
 // append caller's parsed result to callee's parsed result
 void MarkDownParsedResult::AppendParseResult(MarkDownParsedResult& x)
 {
-    if (!m_codeGenTokens.empty() && !x.m_codeGenTokens.empty())
+    if (m_codeGenTokens.empty())
+    {
+        m_codeGenTokens.swap(x.m_codeGenTokens);
+        m_emphasisLookUpTable.swap(x.m_emphasisLookUpTable);
+    }
+    else if (!x.m_codeGenTokens.empty())
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x.m_codeGenTokens.front()));
+        MarkTags(x.m_codeGenTokens.front());
+
+        // x's look up table indexes x's tokens, which now start at the end of ours
+        const size_t offset = m_codeGenTokens.size();
+        for (const auto index : x.m_emphasisLookUpTable)
+        {
+            m_emphasisLookUpTable.push_back(index + offset);
+        }
+        m_codeGenTokens.insert(
+            m_codeGenTokens.end(), std::make_move_iterator(x.m_codeGenTokens.begin()), std::make_move_iterator(x.m_codeGenTokens.end()));
     }
-    m_codeGenTokens.splice(m_codeGenTokens.end(), x.m_codeGenTokens);
-    m_emphasisLookUpTable.splice(m_emphasisLookUpTable.end(), x.m_emphasisLookUpTable);
+    x.Clear();
     m_isHTMLTagsAdded = m_isHTMLTagsAdded || x.HasHtmlTags();
     SetIsCaptured(x.GetIsCaptured());
 }
 
 // append MarkDownHtmlGenerator object to callee's prased result
-void MarkDownParsedResult::AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>& x)
+void MarkDownParsedResult::AppendToTokens(MarkDownHtmlGenerator&& x)
 {
     if (!m_codeGenTokens.empty())
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x));
+        MarkTags(x);
     }
-    m_codeGenTokens.push_back(x);
+    m_codeGenTokens.push_back(std::move(x));
 }
 
-void MarkDownParsedResult::AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>& x)
+void MarkDownParsedResult::AppendToTokensAndLookUpTable(MarkDownHtmlGenerator&& x)
 {
-    m_emphasisLookUpTable.push_back(x);
+    AppendToTokens(std::move(x));
+    m_emphasisLookUpTable.push_back(m_codeGenTokens.size() - 1);
 }
 
 void MarkDownParsedResult::PopFront()
 {
-    m_codeGenTokens.pop_front();
+    if (m_codeGenTokens.empty())
+    {
+        return;
+    }
+
+    m_codeGenTokens.erase(m_codeGenTokens.begin());
+
+    // the tokens moved down by one, so do their indices
+    auto lookUpEnd = std::remove(m_emphasisLookUpTable.begin(), m_emphasisLookUpTable.end(), 0);
+    m_emphasisLookUpTable.erase(lookUpEnd, m_emphasisLookUpTable.end());
+    for (auto& index : m_emphasisLookUpTable)
+    {
+        --index;
+    }
 }
 
 void MarkDownParsedResult::PopBack()
 {
+    if (m_codeGenTokens.empty())
+    {
+        return;
+    }
+
     m_codeGenTokens.pop_back();
+    if (!m_emphasisLookUpTable.empty() && m_emphasisLookUpTable.back() == m_codeGenTokens.size())
+    {
+        m_emphasisLookUpTable.pop_back();
+    }
 }
 
 void MarkDownParsedResult::Clear()
@@ -82,40 +123,63 @@ void MarkDownParsedResult::Clear()
     m_emphasisLookUpTable.clear();
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string of ch
+// create and add new string token that has string of ch
 void MarkDownParsedResult::AddNewTokenToParsedResult(int ch)
 {
-    std::string string_token = std::string(1, static_cast<char>(ch));
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    AppendToTokens({MarkDownHtmlGenerator::TokenType::String, std::string(1, static_cast<char>(ch))});
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string word
-void MarkDownParsedResult::AddNewTokenToParsedResult(std::string& word)
+// create and add new string token that has string word
+void MarkDownParsedResult::AddNewTokenToParsedResult(std::string word)
 {
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(word);
-    AppendToTokens(htmlToken);
+    AppendToTokens({MarkDownHtmlGenerator::TokenType::String, std::move(word)});
 }
 
-// create and add new MarkDownSpaceHtmlGenerator object that has string of ch
+// create and add new new line token that has string of ch
 void MarkDownParsedResult::AddNewLineTokenToParsedResult(char ch)
 {
-    std::string string_token = std::string(1, ch);
-    std::shared_ptr<MarkDownHtmlGenerator> htmlToken = std::make_shared<MarkDownNewLineHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    AppendToTokens({MarkDownHtmlGenerator::TokenType::NewLine, std::string(1, ch)});
 }
 
-std::string MarkDownParsedResult::GenerateHtmlString()
+void MarkDownParsedResult::GenerateHtmlString(std::string& html) const
 {
     // process tags
-    std::ostringstream html;
+    for (const auto& token : m_codeGenTokens)
+    {
+        token.GenerateHtmlString(html);
+    }
+}
 
-    for (auto itr = m_codeGenTokens.begin(); itr != m_codeGenTokens.end(); ++itr)
+void MarkDownParsedResult::GenerateBlocks(std::vector<MarkDownBlock>& blocks) const
+{
+    // block tags are added where the block type changes (see MarkTags), so blocks start there too
+    MarkDownTextRunBuilder builder;
+    const MarkDownHtmlGenerator* previous = nullptr;
+    for (const auto& token : m_codeGenTokens)
     {
-        html << (*itr)->GenerateHtmlString();
+        const auto blockType = token.GetBlockType();
+        if (previous == nullptr || previous->GetBlockType() != blockType)
+        {
+            blocks.push_back(token.CreateBlock());
+        }
+
+        // each list token is an item of its own, a paragraph keeps all of its text in one item
+        if (blockType != MarkDownHtmlGenerator::ContainerBlock || blocks.back().items.empty())
+        {
+            blocks.back().items.emplace_back();
+            builder.SetRuns(blocks.back().items.back());
+        }
+
+        token.GenerateTextRuns(builder);
+        previous = &token;
     }
+}
 
-    return html.str();
+std::vector<MarkDownHtmlGenerator> MarkDownParsedResult::TakeTokens()
+{
+    std::vector<MarkDownHtmlGenerator> tokens = std::move(m_codeGenTokens);
+    Clear();
+    return tokens;
 }
 
 // Following the rules speicified in CommonMark (http://spec.commonmark.org/0.27/)
@@ -132,22 +196,25 @@ std::string MarkDownParsedResult::GenerateHtmlString()
 // add comments -> what it does: generating  n supported features + 1 tokens --> capture them in token class
 void MarkDownParsedResult::MatchLeftAndRightEmphasises()
 {
-    std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> leftEmphasisToExplore;
-    auto currentEmphasis = m_emphasisLookUpTable.begin();
+    // indices of left emphasis tokens in m_codeGenTokens
+    std::vector<size_t> leftEmphasisToExplore;
+    size_t currentEmphasis = 0;
 
-    while (!(currentEmphasis == m_emphasisLookUpTable.end()))
+    while (currentEmphasis < m_emphasisLookUpTable.size())
     {
+        auto& emphasis = m_codeGenTokens[m_emphasisLookUpTable[currentEmphasis]];
+
         // keep exploring left until right token is found
-        if ((*currentEmphasis)->IsLeftEmphasis() ||
-            ((*currentEmphasis)->IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
+        if (emphasis.IsLeftEmphasis() ||
+            (emphasis.IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
         {
-            if ((*currentEmphasis)->IsLeftAndRightEmphasis() && (*currentEmphasis)->IsRightEmphasis())
+            if (emphasis.IsLeftAndRightEmphasis() && emphasis.IsRightEmphasis())
             {
                 // Reverse Direction Type; right empahsis to left emphasis
-                (*currentEmphasis)->ReverseDirectionType();
+                emphasis.ReverseDirectionType();
             }
 
-            leftEmphasisToExplore.push_back(currentEmphasis);
+            leftEmphasisToExplore.push_back(m_emphasisLookUpTable[currentEmphasis]);
             ++currentEmphasis;
         }
         else if (!leftEmphasisToExplore.empty())
@@ -172,9 +239,9 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
             //        as left emphasis
             //        else
             //        use current left emphasis to search, and pop current right emphasis
-            if (!(*currentLeftEmphasis)->IsMatch(*(*currentEmphasis)))
+            if (!m_codeGenTokens[currentLeftEmphasis].IsMatch(emphasis))
             {
-                std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> store;
+                std::vector<size_t> store;
                 bool isFound = false;
                 // search first if matching left emphasis can be found with the right delim
                 // if match found, set the new left emphasis token as current token, and
@@ -184,7 +251,7 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                 while (!leftEmphasisToExplore.empty() && !isFound)
                 {
                     auto leftToken = leftEmphasisToExplore.back();
-                    if ((*leftToken)->IsMatch(*(*currentEmphasis)))
+                    if (m_codeGenTokens[leftToken].IsMatch(emphasis))
                     {
                         currentLeftEmphasis = leftToken;
                         isFound = true;
@@ -213,11 +280,14 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                     }
 
                     // check for the reason why we had to backtrack
-                    if ((*leftEmphasisToExplore.back())->IsSameType(*(*currentEmphasis)))
+                    // only an emphasis that can be both left and right can turn around, anything else would
+                    // never get past this point
+                    if (m_codeGenTokens[leftEmphasisToExplore.back()].IsSameType(emphasis) &&
+                        emphasis.IsLeftAndRightEmphasis())
                     {
                         // right emphasis becomes left emphasis
                         /// create new left empahsis html generator from right
-                        (*currentEmphasis)->ReverseDirectionType();
+                        emphasis.ReverseDirectionType();
                     }
                     else
                     {
@@ -229,16 +299,16 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                 }
             }
             // check which one has leftover delims
-            m_isHTMLTagsAdded = (*currentLeftEmphasis)->GenerateTags(*(*currentEmphasis)) || m_isHTMLTagsAdded;
+            m_isHTMLTagsAdded = m_codeGenTokens[currentLeftEmphasis].GenerateTags(emphasis) || m_isHTMLTagsAdded;
 
             // all right delims used, move to next
-            if ((*currentEmphasis)->IsDone())
+            if (emphasis.IsDone())
             {
                 ++currentEmphasis;
             }
 
             // all left or right delims used, pop
-            if ((*currentLeftEmphasis)->IsDone())
+            if (m_codeGenTokens[currentLeftEmphasis].IsDone())
             {
                 leftEmphasisToExplore.pop_back();
             }
@@ -4,7 +4,6 @@
 
 #include "BaseCardElement.h"
 #include "MarkDownHtmlGenerator.h"
-#include <list>
 
 namespace AdaptiveCards
 {
@@ -18,24 +17,30 @@ public:
     void Translate();
     void AddBlockTags();
 
-    // Write to html string
-    std::string GenerateHtmlString();
+    // Append html string of the parsed tokens to html
+    void GenerateHtmlString(std::string& html) const;
+
+    // Append the parsed tokens to blocks as text runs, starting a new block wherever the html has a block tag
+    void GenerateBlocks(std::vector<MarkDownBlock>& blocks) const;
+
+    // Hand over the parsed tokens, leaving the result empty
+    std::vector<MarkDownHtmlGenerator> TakeTokens();
 
     // Append contents of the given parsing result object
     void AppendParseResult(MarkDownParsedResult&);
 
     // Append html code gen object to parse result
-    void AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>&);
+    void AppendToTokens(MarkDownHtmlGenerator&&);
 
-    // Append emphasis html code gen object to parse result
-    void AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>&);
+    // Append emphasis html code gen object to parse result, and remember it for emphasis matching
+    void AppendToTokensAndLookUpTable(MarkDownHtmlGenerator&&);
 
     // Take a char and convert it html code gen and append it to the result. used to store MarkDown keywords such as
     // '[', ']', '(', ')'
     void AddNewTokenToParsedResult(int ch);
 
     // Take string and convert it html code gen and append it to the result
-    void AddNewTokenToParsedResult(std::string& word);
+    void AddNewTokenToParsedResult(std::string word);
 
     // Take a new line char and convert it html code gen and append it to the result It is used to store MarkDown
     // keywords such as '\r', '\n'
@@ -56,8 +61,9 @@ public:
 
 private:
     void MarkTags(MarkDownHtmlGenerator&);
-    std::list<std::shared_ptr<MarkDownHtmlGenerator>> m_codeGenTokens;
-    std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>> m_emphasisLookUpTable;
+    std::vector<MarkDownHtmlGenerator> m_codeGenTokens;
+    // indices of emphasis tokens in m_codeGenTokens
+    std::vector<size_t> m_emphasisLookUpTable;
     bool m_isHTMLTagsAdded;
     bool m_isCaptured;
 
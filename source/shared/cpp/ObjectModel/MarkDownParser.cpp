@@ -1,24 +1,153 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
-#include <vector>
-#include <iomanip>
-#include <iostream>
 #include "MarkDownParser.h"
 
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define MARKDOWN_SCAN_SSE2
+#elif defined(_M_ARM64) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MARKDOWN_SCAN_NEON
+#endif
+
 using namespace AdaptiveCards;
 
-MarkDownParser::MarkDownParser(const std::string& txt) : m_text(txt), m_hasHTMLTag(false), m_isEscaped(false)
+namespace
+{
+// bytes that can start markdown syntax or need escaping. '.' is checked separately, as it only matters after a
+// digit, where it can end an ordered list marker
+constexpr char c_markDownSyntaxChars[] = {'*', '_', '[', ']', '(', ')', '-', '+', '\r', '\n', '<', '>', '&', '"'};
+
+constexpr bool IsAsciiDigit(const char ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+// checks [from, to) a byte at a time; textBegin is where the whole text starts, so a '.' at from can look behind
+bool HasMarkDownSyntax(const char* textBegin, const char* from, const char* to)
+{
+    for (const char* current = from; current != to; ++current)
+    {
+        if (*current == '.')
+        {
+            if (current != textBegin && IsAsciiDigit(current[-1]))
+            {
+                return true;
+            }
+        }
+        else if (std::find(std::begin(c_markDownSyntaxChars), std::end(c_markDownSyntaxChars), *current) !=
+                 std::end(c_markDownSyntaxChars))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// most texts have no markdown at all, so the scan compares 16 bytes at a time and only looks closer at blocks with
+// a candidate byte in them
+bool HasMarkDownSyntax(std::string_view text)
+{
+    const char* const begin = text.data();
+    const char* const end = begin + text.size();
+    const char* current = begin;
+
+#if defined(MARKDOWN_SCAN_SSE2)
+    for (; end - current >= 16; current += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        __m128i candidates = _mm_cmpeq_epi8(block, _mm_set1_epi8('.'));
+        for (const char syntaxChar : c_markDownSyntaxChars)
+        {
+            candidates = _mm_or_si128(candidates, _mm_cmpeq_epi8(block, _mm_set1_epi8(syntaxChar)));
+        }
+
+        if (_mm_movemask_epi8(candidates) != 0 && HasMarkDownSyntax(begin, current, current + 16))
+        {
+            return true;
+        }
+    }
+#elif defined(MARKDOWN_SCAN_NEON)
+    for (; end - current >= 16; current += 16)
+    {
+        const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(current));
+        uint8x16_t candidates = vceqq_u8(block, vdupq_n_u8('.'));
+        for (const char syntaxChar : c_markDownSyntaxChars)
+        {
+            candidates = vorrq_u8(candidates, vceqq_u8(block, vdupq_n_u8(static_cast<uint8_t>(syntaxChar))));
+        }
+
+        const uint64x2_t halves = vreinterpretq_u64_u8(candidates);
+        if ((vgetq_lane_u64(halves, 0) | vgetq_lane_u64(halves, 1)) != 0 && HasMarkDownSyntax(begin, current, current + 16))
+        {
+            return true;
+        }
+    }
+#endif
+
+    return HasMarkDownSyntax(begin, current, end);
+}
+} // namespace
+
+MarkDownParser::MarkDownParser(const std::string& txt) :
+    m_text(txt), m_hasHTMLTag(false), m_isEscaped(false), m_isPlainText(!HasMarkDownSyntax(m_text)), m_isParsed(false)
 {
 }
 
 // transforms string to html
 std::string MarkDownParser::TransformToHtml()
 {
-    if (m_text.empty())
+    // nothing to parse or escape, the html is the text in a paragraph
+    if (m_isPlainText)
     {
-        return "<p></p>";
+        std::string html;
+        html.reserve(m_text.size() + 7);
+        html += "<p>";
+        html += m_text;
+        html += "</p>";
+        return html;
     }
+
+    ParseAndTranslate();
+
+    // escaping and block tags make html longer than the text it came from;
+    // reserve enough up front that most texts are written without growing the string
+    std::string html;
+    html.reserve(2 * m_text.size() + 16);
+    m_parsedResult.GenerateHtmlString(html);
+    return html;
+}
+
+std::vector<MarkDownBlock> MarkDownParser::TransformToBlocks()
+{
+    std::vector<MarkDownBlock> blocks;
+
+    // nothing to parse or escape, the text is a single paragraph
+    if (m_isPlainText)
+    {
+        auto& paragraph = blocks.emplace_back().items.emplace_back();
+        if (!m_text.empty())
+        {
+            paragraph.push_back({m_text, false, false, {}});
+        }
+        return blocks;
+    }
+
+    ParseAndTranslate();
+    m_parsedResult.GenerateBlocks(blocks);
+    return blocks;
+}
+
+// parses the text once, however many times it's transformed
+void MarkDownParser::ParseAndTranslate()
+{
+    if (m_isParsed)
+    {
+        return;
+    }
+    m_isParsed = true;
+
     // begin parsing html blocks
     ParseBlock();
 
@@ -30,7 +159,6 @@ std::string MarkDownParser::TransformToHtml()
     m_parsedResult.AddBlockTags();
 
     m_hasHTMLTag = m_parsedResult.HasHtmlTags();
-    return m_parsedResult.GenerateHtmlString();
 }
 
 bool MarkDownParser::HasHtmlTags()
@@ -43,6 +171,11 @@ bool MarkDownParser::IsEscaped() const
     return m_isEscaped;
 }
 
+bool MarkDownParser::IsPlainText() const
+{
+    return m_isPlainText;
+}
+
 std::string MarkDownParser::GetRawText() const
 {
     return m_text;
@@ -51,7 +184,8 @@ std::string MarkDownParser::GetRawText() const
 // MarkDown is consisted of Blocks, this methods parses blocks
 void MarkDownParser::ParseBlock()
 {
-    std::stringstream stream(EscapeText());
+    const std::string escaped = EscapeText();
+    MarkDownStream stream(escaped);
     EmphasisParser parser;
     while (!stream.eof())
     {
@@ -63,6 +197,7 @@ void MarkDownParser::ParseBlock()
 std::string MarkDownParser::EscapeText()
 {
     std::string escaped;
+    escaped.reserve(m_text.length());
     unsigned int nonEscapedCounts = 0;
 
     for (std::string::size_type i = 0; i < m_text.length(); i++)
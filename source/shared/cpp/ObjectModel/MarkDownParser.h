@@ -17,18 +17,29 @@ public:
 
     std::string TransformToHtml();
 
+    // Same parse as TransformToHtml, returned as paragraphs and lists of styled text runs rather than html, for
+    // renderers that build text runs directly
+    std::vector<MarkDownBlock> TransformToBlocks();
+
     std::string GetRawText() const;
 
     bool HasHtmlTags();
 
     bool IsEscaped() const;
 
+    // True when the text has nothing markdown or html escaping would act on. TransformToHtml then only wraps the
+    // text in a paragraph, so renderers can show the raw text as is.
+    bool IsPlainText() const;
+
 private:
+    void ParseAndTranslate();
     void ParseBlock();
     std::string EscapeText();
     std::string m_text;
     MarkDownParsedResult m_parsedResult;
     bool m_hasHTMLTag;
     bool m_isEscaped;
+    bool m_isPlainText;
+    bool m_isParsed;
 };
 } // namespace AdaptiveCards
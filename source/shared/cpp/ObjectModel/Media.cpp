@@ -36,6 +36,14 @@ Json::Value Media::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> Media::Clone() const
+{
+    auto clone = std::make_shared<Media>(*this);
+    CopyEach(clone->m_sources);
+    CopyEach(clone->m_captionSources);
+    return clone;
+}
+
 std::string Media::GetPoster() const
 {
     return m_poster;
@@ -68,10 +76,13 @@ std::vector<std::shared_ptr<CaptionSource>>& Media::GetCaptionSources()
 
 void Media::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Poster,
+             AdaptiveCardSchemaKey::AltText,
+             AdaptiveCardSchemaKey::Sources});
+    m_knownProperties = &knownProperties;
 }
 
 void Media::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -23,6 +23,7 @@ public:
     ~Media() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::string GetPoster() const;
     void SetPoster(const std::string& value);
@@ -39,6 +39,11 @@ Json::Value NumberInput::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> NumberInput::Clone() const
+{
+    return std::make_shared<NumberInput>(*this);
+}
+
 std::string NumberInput::GetPlaceholder() const
 {
     return m_placeholder;
@@ -101,9 +106,12 @@ std::shared_ptr<BaseCardElement> NumberInputParser::DeserializeFromString(ParseC
 
 void NumberInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Placeholder,
+             AdaptiveCardSchemaKey::Value,
+             AdaptiveCardSchemaKey::Max,
+             AdaptiveCardSchemaKey::Min});
+    m_knownProperties = &knownProperties;
 }
@@ -19,6 +19,7 @@ public:
     ~NumberInput() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::string GetPlaceholder() const;
     void SetPlaceholder(const std::string& value);
@@ -21,6 +21,25 @@ Json::Value OpenUrlAction::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> OpenUrlAction::Clone() const
+{
+    return std::make_shared<OpenUrlAction>(*this);
+}
+
+void OpenUrlAction::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<OpenUrlAction>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    BaseActionElement::WriteProperties(writer);
+    writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url), m_url);
+    writer.EndObject();
+}
+
 std::string OpenUrlAction::GetUrl() const
 {
     return m_url;
@@ -47,5 +66,6 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::DeserializeFromString(Pa
 
 void OpenUrlAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::Url});
+    m_knownProperties = &knownProperties;
 }
@@ -19,6 +19,8 @@ public:
     ~OpenUrlAction() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
+    void SerializeTo(JsonWriter& writer) const override;
 
     std::string GetUrl() const;
     void SetUrl(const std::string& value);
@@ -10,19 +10,35 @@ namespace AdaptiveCards
 {
 ParseContext::ParseContext() :
     elementParserRegistration{std::make_shared<ElementParserRegistration>()},
-    actionParserRegistration{std::make_shared<ActionParserRegistration>()}, warnings{}, m_elementIds{}, m_idStack{},
-    m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false)
+    actionParserRegistration{std::make_shared<ActionParserRegistration>()}, warnings{}, m_idNumbers{}, m_idUses{},
+    m_firstIdUses{}, m_idStack{}, m_fallbackIds{}, m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false),
+    m_buildsElementIndex(false)
 {
 }
 
 ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementRegistration, std::shared_ptr<ActionParserRegistration> actionRegistration) :
-    warnings{}, m_elementIds{}, m_idStack{}, m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{},
-    m_canFallbackToAncestor(false)
+    warnings{}, m_idNumbers{}, m_idUses{}, m_firstIdUses{}, m_idStack{}, m_fallbackIds{}, m_parentalContainerStyles{},
+    m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false), m_buildsElementIndex(false)
 {
     elementParserRegistration = (elementRegistration) ? elementRegistration : std::make_shared<ElementParserRegistration>();
     actionParserRegistration = (actionRegistration) ? actionRegistration : std::make_shared<ActionParserRegistration>();
 }
 
+void ParseContext::Reset()
+{
+    warnings.clear();
+    m_idNumbers.clear();
+    m_idUses.clear();
+    m_firstIdUses.clear();
+    m_idStack.clear();
+    m_fallbackIds.clear();
+    m_parentalContainerStyles.clear();
+    m_parentalPadding.clear();
+    m_parentalBleedDirection.clear();
+    m_canFallbackToAncestor = false;
+    m_language.clear();
+}
+
 // Detecting ID collisions
 //
 // A word on nomenclature: There are two identifiers in discussion below. "ID" refers to the value of the "id"
@@ -142,6 +158,14 @@ ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementReg
 // Push stack: [id: "duplicate", internalId: 5, isFallback: false] <-- Input.Text
 // Pop stack: Collision detected in ID list. Current element isn't a fallback child, so throw an exception.
 // ================================================================================
+//
+// Precisely: the times we've seen the ID are looked at in the order we saw them, up to the first one that was in the
+// fallback content of the element being popped (no collision) or in that of its parent (no collision, so long as no
+// earlier time was looked at first). Any other time we've seen it is a collision. Rather than walk the list of times
+// we've seen an ID on every pop, we number them, and for each fallback internal ID keep only the number of the first
+// time we saw the ID with it: the two we need to look up then decide the outcome. Together with a stack of the
+// fallback entries on the ID stack, for finding the nearest fallback, that makes validation linear in the size of
+// the card, however deeply its elements are nested or often its IDs are repeated.
 
 // Push the provided state on to our ID stack (see comment above)
 void ParseContext::PushElement(const std::string& idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback /*=false*/)
@@ -152,94 +176,99 @@ void ParseContext::PushElement(const std::string& idJsonProperty, const Adaptive
             ErrorStatusCode::InvalidPropertyValue, "Attemping to push an element on to the stack with an invalid ID");
     }
 
-    m_idStack.push_back({idJsonProperty, internalId, isFallback});
+    // ids of fallback entries are never checked (see PopElement), so they're not interned
+    const unsigned int id = (idJsonProperty.empty() || isFallback) ? c_noId : InternId(idJsonProperty);
+    m_idStack.push_back({id, internalId, isFallback});
+    if (isFallback)
+    {
+        m_fallbackIds.push_back(internalId);
+    }
+}
+
+unsigned int ParseContext::InternId(const std::string& id)
+{
+    const auto number = m_idNumbers.try_emplace(id, static_cast<unsigned int>(m_idUses.size() + 1));
+    if (number.second)
+    {
+        m_idUses.push_back({&number.first->first, 0, InternalId{}});
+    }
+    return number.first->second;
+}
+
+unsigned int ParseContext::GetFirstIdUse(unsigned int id, const AdaptiveCards::InternalId& fallbackId) const
+{
+    const IdUses& uses = m_idUses[id - 1];
+    if (uses.count == 0)
+    {
+        return c_noUse;
+    }
+    if (uses.firstFallbackId == fallbackId)
+    {
+        return 0;
+    }
+
+    const auto use = m_firstIdUses.find((static_cast<unsigned long long>(id) << 32) | fallbackId.Hash());
+    return (use == m_firstIdUses.end()) ? c_noUse : use->second;
 }
 
 // Pop the last id off our stack and perform validation (see comment above)
 void ParseContext::PopElement()
 {
     // about to pop an element off the stack. perform collision list maintenance and detection.
-    const auto& idsToPop = m_idStack.back();
-    const std::string& elementId{std::get<TupleIndex::Id>(idsToPop)};
-    const auto& elementInternalId{std::get<TupleIndex::InternalId>(idsToPop)};
-    const bool isFallback{std::get<TupleIndex::IsFallback>(idsToPop)};
+    const StackEntry& element = m_idStack.back();
 
-    if (!elementId.empty())
+    if (element.id != c_noId)
     {
-        bool haveCollision = false;
-        const auto& nearestFallbackId = GetNearestFallbackId(elementInternalId);
+        IdUses& uses = m_idUses[element.id - 1];
+        const auto& nearestFallbackId = GetNearestFallbackId(element.internalId);
 
-        // Walk through the list of elements we've seen with this ID
-        for (auto currentEntry = m_elementIds.find(elementId); currentEntry != m_elementIds.end(); ++currentEntry)
+        if (uses.count != 0)
         {
-            const AdaptiveCards::InternalId& entryFallbackId = currentEntry->second;
-
-            // If the element we're about to pop is the fallback parent for this entry, then there's no collision
+            // If the element we're about to pop is the fallback parent for a use of this ID, then there's no collision
             // (fallback content is allowed to have the same ID as its parent)
-            if (entryFallbackId == elementInternalId)
-            {
-                haveCollision = false;
-                break;
-            }
+            const unsigned int fallbackChildUse = GetFirstIdUse(element.id, element.internalId);
 
-            // The inverse of the above -- if this element's fallback parent is the entry we're looking at, there's
-            // no collision.
-            try
-            {
-                // -1 is the last item on the stack (the one we're about to pop)
-                // -2 is the parent of the last item on the stack
-                const auto& previousInStack = m_idStack.at(m_idStack.size() - 2);
-                if (std::get<TupleIndex::InternalId>(previousInStack) == entryFallbackId)
-                {
-                    // we're looking at a fallback entry for our parent
-                    break;
-                }
-            }
-            catch (const std::out_of_range&)
-            {
-                // we're looking at a toplevel element
-            }
+            // The inverse of the above -- if this element's fallback parent is the one for a use, there's no collision
+            // with it. A toplevel element has no parent.
+            const unsigned int parentFallbackUse =
+                (m_idStack.size() > 1) ? GetFirstIdUse(element.id, m_idStack[m_idStack.size() - 2].internalId) : c_noUse;
 
-            // if the element we're inspecting is fallback content, continue on to the next entry
-            if (isFallback)
+            // whichever of the two comes first decides; every use before it is a collision
+            const bool haveCollision = (fallbackChildUse == c_noUse || fallbackChildUse > parentFallbackUse) && parentFallbackUse != 0;
+            if (haveCollision)
             {
-                continue;
+                throw AdaptiveCardParseException(ErrorStatusCode::IdCollision, "Collision detected for id '" + *uses.id + "'");
             }
-
-            // at this point, we may or may not have a collision depending on additional entries.
-            haveCollision = true;
         }
 
-        if (haveCollision)
+        if (uses.count == 0)
         {
-            throw AdaptiveCardParseException(
-                ErrorStatusCode::IdCollision, "Collision detected for id '" + elementId + "'");
+            uses.firstFallbackId = nearestFallbackId;
         }
-
-        // no need to add an entry for this element if it's fallback (we'll add one when we parse it for non-fallback)
-        if (!isFallback)
+        else if (nearestFallbackId != uses.firstFallbackId)
         {
-            m_elementIds.emplace(std::make_pair(elementId, nearestFallbackId));
+            m_firstIdUses.try_emplace((static_cast<unsigned long long>(element.id) << 32) | nearestFallbackId.Hash(), uses.count);
         }
+        uses.count++;
     }
 
+    if (element.isFallback)
+    {
+        m_fallbackIds.pop_back();
+    }
     m_idStack.pop_back();
 }
 
-// Walk stack looking for first element to be marked fallback (which isn't the ID we're supposed to skip), then
-// return its internal ID. If none, return an invalid ID. (see comment above)
+// Look for the innermost fallback entry on the stack (which isn't the ID we're supposed to skip), then return its
+// internal ID. If none, return an invalid ID. (see comment above)
 const AdaptiveCards::InternalId ParseContext::GetNearestFallbackId(const AdaptiveCards::InternalId& skipId) const
 {
-    for (auto curElement = m_idStack.crbegin(); curElement != m_idStack.crend(); ++curElement)
+    // only the innermost can be skipped, as an element's own fallback entry is popped before it is
+    for (auto fallbackId = m_fallbackIds.crbegin(); fallbackId != m_fallbackIds.crend(); ++fallbackId)
     {
-        if (std::get<TupleIndex::IsFallback>(*curElement)) // if element is fallback
+        if (*fallbackId != skipId)
         {
-            // retrieve the internal ID
-            const AdaptiveCards::InternalId& internalId = std::get<TupleIndex::InternalId>(*curElement);
-            if (internalId != skipId)
-            {
-                return internalId;
-            }
+            return *fallbackId;
         }
     }
     AdaptiveCards::InternalId invalidId;
@@ -12,6 +12,11 @@
 namespace AdaptiveCards
 {
 class StyledCollectionElement;
+
+// Holds the state of a single parse. A ParseContext must not be used by more than one thread at a time, but cards
+// may be deserialized concurrently (AdaptiveCard::Deserialize and friends) as long as each thread uses its own
+// context. Contexts on different threads may share parser registrations, provided nothing is registered or removed
+// while they are in use.
 class ParseContext
 {
 public:
@@ -21,9 +26,31 @@ public:
     std::shared_ptr<ElementParserRegistration> elementParserRegistration;
     std::shared_ptr<ActionParserRegistration> actionParserRegistration;
     std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+
+    // Discards everything left over from a previous parse (warnings, ID tracking, style and bleed state, language)
+    // so that the context can be used for another card. The parser registrations are kept, as is the capacity of
+    // the context's internal buffers.
+    void Reset();
+
+    // When enabled, a card parsed with this context is indexed as part of the parse (see
+    // AdaptiveCard::IndexElements), rather than by its first GetElementById. Off by default; kept by Reset.
+    void SetBuildsElementIndex(bool buildsElementIndex)
+    {
+        m_buildsElementIndex = buildsElementIndex;
+    }
+    bool GetBuildsElementIndex() const
+    {
+        return m_buildsElementIndex;
+    }
+
     // Push/PopElement are used during parsing to track the tree structure of a card.
     void PushElement(const std::string& idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback = false);
     void PopElement();
+    // whether an element is being parsed, as it is while the card of a ShowCard action is
+    bool IsParsingElement() const
+    {
+        return !m_idStack.empty();
+    }
 
     // tells if it's possible to fallback to ancestor
     bool GetCanFallbackToAncestor() const
@@ -50,35 +77,61 @@ public:
 
 private:
     const AdaptiveCards::InternalId GetNearestFallbackId(const AdaptiveCards::InternalId& skipId) const;
-    // This enum is just a helper to keep track of the position of contents within the std::tuple used in
-    // m_idStack below. We don't use enum class here because we don't want typed values for use in std::get
-    enum TupleIndex : unsigned int
+    unsigned int InternId(const std::string& id);
+    // the position, among the uses of the interned id, of the first use with the given fallback ID (c_noUse if none)
+    unsigned int GetFirstIdUse(unsigned int id, const AdaptiveCards::InternalId& fallbackId) const;
+
+    static constexpr unsigned int c_noId = 0;
+    static constexpr unsigned int c_noUse = std::numeric_limits<unsigned int>::max();
+
+    // what we know of an ID json property that has been seen during a parse
+    struct IdUses
+    {
+        const std::string* id{};
+        // how many elements have had it so far (not counting fallback entries on the stack)
+        unsigned int count{};
+        // the fallback ID of the first of them; those of later ones are in m_firstIdUses, as most IDs are used once
+        AdaptiveCards::InternalId firstFallbackId{};
+    };
+
+    // an element being parsed, as pushed by PushElement
+    struct StackEntry
     {
-        Id = 0U,
-        InternalId,
-        IsFallback
+        // the interned ID json property, or c_noId if the element has none (or is a fallback entry, for which ids
+        // aren't checked)
+        unsigned int id;
+        AdaptiveCards::InternalId internalId;
+        bool isFallback;
     };
 
-    // m_elementIds keeps track of which elements we've seen during a parse. This is used to detect collisions on id
-    // within an Adaptive Card json file. Specifically, we track which non-empty ids we've seen and correllate them
-    // to the internal ID of the element for which it serves fallback (if any). We use unordered_multimap here as
-    // duplicate entries are valid in some circumstances (i.e. where fallback content shares an ID with its parent)
+    // ID json properties are interned as they're pushed: each distinct one seen during a parse is numbered (from
+    // 1) and the stack and the collision bookkeeping below refer to it by number. m_idUses[number - 1] tracks it.
+    std::unordered_map<std::string, unsigned int> m_idNumbers;
+    std::vector<IdUses> m_idUses;
+
+    // These keep track of which elements we've seen during a parse. This is used to detect collisions on id within
+    // an Adaptive Card json file. Specifically, we number the uses of each non-empty id in the order we see them, and
+    // correlate each to the internal ID of the element for which it serves fallback (if any). Duplicate uses are
+    // valid in some circumstances (i.e. where fallback content shares an ID with its parent). Of the uses of an id
+    // that share a fallback ID, only the first matters to collision detection, so only the first is kept (here, unless
+    // it is the id's first use of all, which IdUses keeps).
     //
-    //             map ID json property           ->             fallback ID
-    std::unordered_multimap<std::string, AdaptiveCards::InternalId> m_elementIds;
+    //     (interned id << 32 | fallback internal ID)      ->      position of its first use
+    std::unordered_map<unsigned long long, unsigned int> m_firstIdUses;
 
     // m_idStack is the stack we use during parse time to track the hierarchy of cards as they are encountered.
     // Any time we parse an element we push it on to the stack, parse its children (if any), then pop it off the
     // stack. When we pop off the stack, we perform id collision detection.
-    //
-    //                             (ID,  internal ID, isFallback)[]
-    std::vector<std::tuple<std::string, AdaptiveCards::InternalId, bool>> m_idStack;
+    std::vector<StackEntry> m_idStack;
+    // the internal IDs of the fallback entries on m_idStack, innermost last
+    std::vector<AdaptiveCards::InternalId> m_fallbackIds;
 
     std::vector<ContainerStyle> m_parentalContainerStyles;
     std::vector<AdaptiveCards::InternalId> m_parentalPadding;
     std::vector<ContainerBleedDirection> m_parentalBleedDirection;
 
     bool m_canFallbackToAncestor;
+    bool m_buildsElementIndex;
     std::string m_language;
 };
 } // namespace AdaptiveCards
@@ -8,16 +8,15 @@
 #include "TextBlock.h"
 #include "Container.h"
 #include "ShowCardAction.h"
+#include "JsonWriter.h"
 
 namespace
 {
-Json::StreamWriterBuilder CreateJsonStreamWriter()
+// Looks up propertyName without copying the value. Missing properties read as null, as they do with Json::Value::get.
+const Json::Value& GetPropertyValue(const Json::Value& json, const std::string& propertyName)
 {
-    Json::StreamWriterBuilder builder;
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
-
-    return builder;
+    const Json::Value* propertyValue = json.find(propertyName.data(), propertyName.data() + propertyName.size());
+    return (propertyValue == nullptr) ? Json::Value::nullSingleton() : *propertyValue;
 }
 } // namespace
 
@@ -25,13 +24,12 @@ namespace AdaptiveCards
 {
 std::string ParseUtil::JsonToString(const Json::Value& json)
 {
-    const thread_local Json::StreamWriterBuilder builder = ::CreateJsonStreamWriter();
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-
-    std::ostringstream outStream;
-    writer->write(json, &outStream);
-    outStream << std::endl;
-    return outStream.str();
+    // JsonWriter writes what a Json::StreamWriter with no indentation or comments would
+    JsonWriter writer;
+    writer.Value(json);
+    std::string output = writer.TakeString();
+    output += '\n';
+    return output;
 }
 
 void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
@@ -56,7 +54,7 @@ std::string ParseUtil::GetTypeAsString(const Json::Value& json)
         throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, ss.str());
     }
 
-    return json.get(typeKey, Json::Value()).asString();
+    return json[typeKey].asString();
 }
 
 std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
@@ -87,7 +85,7 @@ std::string ParseUtil::TryGetString(const Json::Value& json, AdaptiveCardSchemaK
 std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -126,7 +124,7 @@ std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey
 std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -147,7 +145,7 @@ std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchema
 std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -189,7 +187,7 @@ bool ParseUtil::GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool
 std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -208,7 +206,7 @@ std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, Adaptive
 unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -251,7 +249,7 @@ int ParseUtil::GetInt(const Json::Value& json, AdaptiveCardSchemaKey key, int de
 std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -270,7 +268,7 @@ std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCa
 std::optional<double> ParseUtil::GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -317,14 +315,18 @@ void ParseUtil::ExpectKeyAndValueType(const Json::Value& json, const char* expec
             ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following key: " + std::string(expectedKey));
     }
 
-    auto value = json.get(expectedKey, Json::Value());
-    throwIfWrongType(value);
+    throwIfWrongType(json[expectedKey]);
 }
 
 Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+{
+    return GetArrayRef(json, key, isRequired);
+}
+
+const Json::Value& ParseUtil::GetArrayRef(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto elementArray = json.get(propertyName, Json::Value());
+    const Json::Value& elementArray = ::GetPropertyValue(json, propertyName);
 
     if (!elementArray.isNull() && !elementArray.isArray())
     {
@@ -345,7 +347,7 @@ Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey k
 
 std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto jsonArray = ParseUtil::GetArray(json, key, isRequired);
+    const auto& jsonArray = ParseUtil::GetArrayRef(json, key, isRequired);
     std::vector<std::string> strings;
 
     strings.reserve(jsonArray.size());
@@ -359,13 +361,18 @@ std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, Adap
 }
 
 Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
+{
+    return GetJsonValueFromString(jsonString.data(), jsonString.data() + jsonString.size());
+}
+
+Json::Value ParseUtil::GetJsonValueFromString(const char* begin, const char* end)
 {
     const thread_local Json::CharReaderBuilder readerBuilder;
     std::unique_ptr<Json::CharReader> reader(readerBuilder.newCharReader());
 
     Json::Value jsonValue;
     std::string errors;
-    if (!reader->parse(jsonString.data(), jsonString.data() + jsonString.size(), &jsonValue, &errors))
+    if (!reader->parse(begin, end, &jsonValue, &errors))
     {
         std::ostringstream exceptionMsg{};
         exceptionMsg << "Expected JSON Object (" << errors << ")";
@@ -376,9 +383,14 @@ Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
 }
 
 Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+{
+    return ExtractJsonValueRef(json, key, isRequired);
+}
+
+const Json::Value& ParseUtil::ExtractJsonValueRef(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value& propertyValue = ::GetPropertyValue(json, propertyName);
     if (isRequired && propertyValue.empty())
     {
         throw AdaptiveCardParseException(
@@ -406,10 +418,10 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContex
     // Get the element's type
     std::string typeString = GetTypeAsString(json);
 
-    auto parser = context.actionParserRegistration->GetParser(typeString);
+    ActionElementParser* parser = context.actionParserRegistration->GetParser(typeString).get();
     if (parser == nullptr)
     {
-        parser = context.actionParserRegistration->GetParser("UnknownAction");
+        parser = context.actionParserRegistration->GetParser("UnknownAction").get();
     }
 
     // Parse it if it's allowed by the current parsers
@@ -425,7 +437,7 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContex
 std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
     ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArrayRef(json, key, isRequired);
 
     std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -450,7 +462,7 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
 
 std::shared_ptr<BaseActionElement> ParseUtil::GetAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+    const auto& selectAction = ParseUtil::ExtractJsonValueRef(json, key, isRequired);
 
     if (!selectAction.empty())
     {
@@ -478,7 +490,7 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabelFromJsonValue(ParseContext&
             ErrorStatusCode::InvalidPropertyValue, "Element type is not a string, TextBlock or RichTextBlock");
     }
 
-    auto parser = context.elementParserRegistration->GetParser(typeString);
+    const auto& parser = context.elementParserRegistration->GetParser(typeString);
 
     // Parse it if it's allowed by the current parsers
     if (parser != nullptr)
@@ -492,7 +504,7 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabelFromJsonValue(ParseContext&
 
 std::shared_ptr<BaseCardElement> ParseUtil::GetLabel(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    auto label = ParseUtil::ExtractJsonValue(json, key);
+    const auto& label = ParseUtil::ExtractJsonValueRef(json, key);
 
     if (!label.empty())
     {
@@ -52,12 +52,22 @@ namespace ParseUtil
 
     Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
+    // Same as GetArray, but returns a reference into json instead of a copy of the array
+    const Json::Value& GetArrayRef(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
     std::vector<std::string> GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     Json::Value GetJsonValueFromString(const std::string& jsonString);
 
+    Json::Value GetJsonValueFromString(const char* begin, const char* end);
+
     Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
 
+    // Same as ExtractJsonValue, but returns a reference into jsonRoot (or to a shared null value if the key is
+    // missing) instead of a copy. Element deserializers should prefer this so that looking up a child collection
+    // doesn't copy the whole subtree beneath it.
+    const Json::Value& ExtractJsonValueRef(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+
     template <typename T, typename Fn>
     std::optional<T> GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter);
 
@@ -90,6 +100,18 @@ namespace ParseUtil
         bool isRequired = false,
         const std::string& impliedType = std::string());
 
+    // Deserializes a collection of elementCount elements whose JSON is supplied one element at a time by
+    // getElementJson(index). GetElementCollection uses this over a Json::Value array;
+    // AdaptiveCard::DeserializeFromStringByElement uses it to build the Json::Value of each body element only
+    // while that element is being parsed.
+    template <typename T, typename Fn>
+    std::vector<std::shared_ptr<T>> GetElementCollectionFromSource(
+        bool isTopToBottomContainer,
+        ParseContext& context,
+        size_t elementCount,
+        Fn getElementJson,
+        const std::string& impliedType = std::string());
+
     template <typename T>
     std::vector<std::shared_ptr<T>> GetElementCollectionOfSingleType(
         ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, DeserializeFn<T>& deserializer, bool isRequired = false);
@@ -127,8 +149,7 @@ std::optional<T> ParseUtil::GetOptionalEnumValue(const Json::Value& json, Adapti
     std::string propertyValueStr = "";
     try
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto const& propertyValue = json.get(propertyName, Json::Value());
+        const auto& propertyValue = ParseUtil::ExtractJsonValueRef(json, key);
         if (propertyValue.empty())
         {
             return std::nullopt;
@@ -175,7 +196,7 @@ std::shared_ptr<T> ParseUtil::DeserializeValue(
     const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
     bool isRequired)
 {
-    return deserializer(context, ParseUtil::ExtractJsonValue(json, key, isRequired));
+    return deserializer(context, ParseUtil::ExtractJsonValueRef(json, key, isRequired));
 }
 
 // Deserialize value at the given key
@@ -183,7 +204,7 @@ template <typename T>
 std::shared_ptr<T> ParseUtil::DeserializeValue(
     const Json::Value& json, AdaptiveCardSchemaKey key, const std::function<std::shared_ptr<T>(const Json::Value&)>& deserializer, bool isRequired)
 {
-    return deserializer(ParseUtil::ExtractJsonValue(json, key, isRequired));
+    return deserializer(ParseUtil::ExtractJsonValueRef(json, key, isRequired));
 }
 
 template <typename T>
@@ -205,7 +226,7 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
     const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArrayRef(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
@@ -239,7 +260,7 @@ T ParseUtil::ExtractJsonValueAndMergeWithDefault(
     T result = defaultValue;
     try
     {
-        auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
+        const auto& jsonObject = ParseUtil::ExtractJsonValueRef(rootJson, key);
         if (!jsonObject.empty())
         {
             result = deserializer(jsonObject, defaultValue);
@@ -263,26 +284,23 @@ static void ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Va
     T::ParseJsonObject(context, json, baseElement);
 }
 
-template <typename T>
-std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
-    bool isTopToBottomContainer, ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired, const std::string& impliedType)
+template <typename T, typename Fn>
+std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionFromSource(
+    bool isTopToBottomContainer, ParseContext& context, size_t elementCount, Fn getElementJson, const std::string& impliedType)
 {
-    auto elementArray = GetArray(json, key, isRequired);
-
     std::vector<std::shared_ptr<T>> elements;
-    if (elementArray.empty())
+    if (elementCount == 0)
     {
         return elements;
     }
 
-    const size_t elemSize = elementArray.size();
-    elements.reserve(elemSize);
+    elements.reserve(elementCount);
 
     const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
 
-    size_t currentIndex = 0;
-    for (auto& curJsonValue : elementArray)
+    for (size_t currentIndex = 0; currentIndex < elementCount; currentIndex++)
     {
+        const Json::Value& curJsonValue = getElementJson(currentIndex);
         ContainerBleedDirection currentBleedState = previousBleedState;
 
         if (currentIndex != 0)
@@ -293,7 +311,7 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
             currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedUp : ~ContainerBleedDirection::BleedLeft;
         }
 
-        if (currentIndex != (elemSize - 1))
+        if (currentIndex != (elementCount - 1))
         {
             // In a top to bottom container (Container, Column) only the last item can bleed down, in a left
             // to right container (ColumnSet) only the last item can bleed right. If we're not the last item,
@@ -304,7 +322,10 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
         context.PushBleedDirection(currentBleedState);
 
         // If all items in this collection have the same implied type (i.e. Columns), verify
-        // that if set it is set correctly and set it if it isn't
+        // that if set it is set correctly and set it if it isn't. The source json is borrowed, so an element
+        // that omits its type is copied before the type is filled in.
+        Json::Value elementWithImpliedType;
+        const Json::Value* elementJson = &curJsonValue;
         if (!impliedType.empty())
         {
             const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
@@ -314,19 +335,37 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
                     ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
             }
 
-            curJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
+            const auto& typeValue = ParseUtil::ExtractJsonValueRef(curJsonValue, AdaptiveCardSchemaKey::Type);
+            if (!typeValue.isString() || typeValue.asString() != typeString)
+            {
+                elementWithImpliedType = curJsonValue;
+                elementWithImpliedType[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
+                elementJson = &elementWithImpliedType;
+            }
         }
 
         std::shared_ptr<BaseElement> curElement;
-        ParseJsonObject<T>(context, curJsonValue, curElement);
+        ParseJsonObject<T>(context, *elementJson, curElement);
         elements.push_back(std::static_pointer_cast<T>(curElement));
 
         // restores the parent's bleed state
         context.PopBleedDirection();
-
-        currentIndex++;
     }
 
     return elements;
 }
+
+template <typename T>
+std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
+    bool isTopToBottomContainer, ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired, const std::string& impliedType)
+{
+    const auto& elementArray = GetArrayRef(json, key, isRequired);
+
+    return GetElementCollectionFromSource<T>(
+        isTopToBottomContainer,
+        context,
+        elementArray.size(),
+        [&elementArray](size_t index) -> const Json::Value& { return elementArray[static_cast<Json::ArrayIndex>(index)]; },
+        impliedType);
+}
 } // namespace AdaptiveCards
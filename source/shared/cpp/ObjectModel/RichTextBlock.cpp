@@ -38,6 +38,16 @@ Json::Value RichTextBlock::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> RichTextBlock::Clone() const
+{
+    auto clone = std::make_shared<RichTextBlock>(*this);
+    for (auto& inlineElement : clone->m_inlines)
+    {
+        inlineElement = inlineElement->Clone();
+    }
+    return clone;
+}
+
 std::optional<HorizontalAlignment> RichTextBlock::GetHorizontalAlignment() const
 {
     return m_hAlignment;
@@ -80,7 +90,10 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::DeserializeFromString(Pars
 
 void RichTextBlock::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Inlines)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::HorizontalAlignment,
+             AdaptiveCardSchemaKey::Inlines});
+    m_knownProperties = &knownProperties;
 }
@@ -23,6 +23,7 @@ public:
     ~RichTextBlock() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::optional<HorizontalAlignment> GetHorizontalAlignment() const;
     void SetHorizontalAlignment(const std::optional<HorizontalAlignment> value);
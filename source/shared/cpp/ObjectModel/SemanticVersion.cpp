@@ -6,6 +6,32 @@
 
 using namespace AdaptiveCards;
 
+namespace
+{
+// Parses one component of a version: a non-empty run of decimal digits whose value fits in an int. On success,
+// current is left pointing just past the digits.
+bool ParseVersionComponent(const char*& current, const char* end, unsigned int& value)
+{
+    constexpr unsigned int maxValue = static_cast<unsigned int>(std::numeric_limits<int>::max());
+
+    const char* start = current;
+    unsigned int parsed = 0;
+    while (current != end && *current >= '0' && *current <= '9')
+    {
+        const unsigned int digit = static_cast<unsigned int>(*current - '0');
+        if (parsed > (maxValue - digit) / 10)
+        {
+            return false;
+        }
+        parsed = parsed * 10 + digit;
+        ++current;
+    }
+
+    value = parsed;
+    return current != start;
+}
+} // namespace
+
 SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor(0), _build(0), _revision(0)
 {
     // valid:
@@ -18,49 +44,32 @@ SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor
     // ""
     // "1."
     // "F"
+    //
+    // Each component must fit in an int.
+
+    const char* current = version.data();
+    const char* const end = current + version.size();
+    unsigned int* const components[] = {&_major, &_minor, &_build, &_revision};
 
     bool versionValid = false;
-#pragma warning(push)
-#pragma warning(disable : 26426)
-    // disable spurious warning (Global initializer calls a non-constexpr function.) -- this isn't global
-    static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
-#pragma warning(pop)
-    std::smatch subMatches;
-    if (std::regex_match(version, subMatches, versionMatch))
+    for (unsigned int* component : components)
     {
-        versionValid = true;
-        // subMatches[0] contains the entire string, so no need to refer to it here
-
-        try
+        if (!ParseVersionComponent(current, end, *component))
         {
-            // subMatches[1] contains the major version
-            if (subMatches[1].matched)
-            {
-                _major = std::stoi(subMatches[1]);
-            }
-
-            if (subMatches[2].matched)
-            {
-                // subMatches[2] contains the minor version
-                _minor = std::stoi(subMatches[2]);
-            }
-
-            if (subMatches[3].matched)
-            {
-                // subMatches[3] contains the build version
-                _build = std::stoi(subMatches[3]);
-            }
+            break;
+        }
 
-            if (subMatches[4].matched)
-            {
-                // subMatches[4] contains the revision
-                _revision = std::stoi(subMatches[4]);
-            }
+        if (current == end)
+        {
+            versionValid = true;
+            break;
         }
-        catch (const std::out_of_range&)
+
+        if (*current != '.')
         {
-            versionValid = false;
+            break;
         }
+        ++current;
     }
 
     if (!versionValid)
@@ -10,6 +10,11 @@
 #include "SemanticVersion.h"
 #include "ParseContext.h"
 #include "BackgroundImage.h"
+#include "JsonStreamReader.h"
+#include "ElementTraversal.h"
+#include "WorkerPool.h"
+
+#include <thread>
 
 using namespace AdaptiveCards;
 
@@ -64,7 +69,6 @@ AdaptiveCard::AdaptiveCard(
     m_language(language), m_verticalContentAlignment(verticalContentAlignment), m_height(height),
     m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_additionalProperties{}
 {
-    PopulateKnownPropertiesSet();
 }
 
 AdaptiveCard::AdaptiveCard(
@@ -116,7 +120,6 @@ AdaptiveCard::AdaptiveCard(
     m_verticalContentAlignment(verticalContentAlignment), m_height(height),
     m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_body(body), m_actions(actions), m_additionalProperties{}
 {
-    PopulateKnownPropertiesSet();
 }
 
 #ifdef __ANDROID__
@@ -173,6 +176,12 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(
 #else
 std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json, const std::string& rendererVersion, ParseContext& context)
 #endif // __ANDROID__
+{
+    return _DeserializeCard(json, rendererVersion, context, nullptr);
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::_DeserializeCard(
+    const Json::Value& json, const std::string& rendererVersion, ParseContext& context, const ElementSources* elementSources)
 {
     ParseUtil::ThrowIfNotJsonObject(json);
 
@@ -204,7 +213,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         const SemanticVersion rendererMaxVersion(rendererVersion);
         const SemanticVersion cardVersion(version);
 
-        if (rendererVersion < cardVersion)
+        if (rendererMaxVersion < cardVersion)
         {
             if (fallbackText.empty())
             {
@@ -241,9 +250,44 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), &context.warnings).value_or(0);
 
     // Parse body
-    auto body = ParseUtil::GetElementCollection<BaseCardElement>(true, context, json, AdaptiveCardSchemaKey::Body, false);
+    std::vector<std::shared_ptr<BaseCardElement>> body;
+    if (elementSources && elementSources->hasBody)
+    {
+        // only the element currently being parsed exists as a Json::Value
+        Json::Value currentElement;
+        body = ParseUtil::GetElementCollectionFromSource<BaseCardElement>(
+            true, // isTopToBottomContainer
+            context,
+            elementSources->body.size(),
+            [&currentElement, elementSources](size_t index) -> Json::Value& {
+                currentElement = elementSources->GetJsonValue(AdaptiveCardSchemaKey::Body, index);
+                return currentElement;
+            });
+    }
+    else
+    {
+        body = ParseUtil::GetElementCollection<BaseCardElement>(true, context, json, AdaptiveCardSchemaKey::Body, false);
+    }
+
     // Parse actions if present
-    auto actions = ParseUtil::GetActionCollection(context, json, AdaptiveCardSchemaKey::Actions, false);
+    std::vector<std::shared_ptr<BaseActionElement>> actions;
+    if (elementSources && elementSources->hasActions)
+    {
+        actions.reserve(elementSources->actions.size());
+        for (size_t index = 0; index < elementSources->actions.size(); index++)
+        {
+            auto action =
+                ParseUtil::GetActionFromJsonValue(context, elementSources->GetJsonValue(AdaptiveCardSchemaKey::Actions, index));
+            if (action != nullptr)
+            {
+                actions.push_back(action);
+            }
+        }
+    }
+    else
+    {
+        actions = ParseUtil::GetActionCollection(context, json, AdaptiveCardSchemaKey::Actions, false);
+    }
 
     EnsureShowCardVersions(actions, version);
 
@@ -259,6 +303,12 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
     result->SetAdditionalProperties(additionalProperties);
 
+    // the card of a ShowCard action is indexed with the card it's in
+    if (context.GetBuildsElementIndex() && !context.IsParsingElement())
+    {
+        result->IndexElements();
+    }
+
     return std::make_shared<ParseResult>(result, context.warnings);
 }
 
@@ -283,6 +333,217 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::stri
     return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
 }
 
+Json::Value AdaptiveCard::ElementSources::GetJsonValue(AdaptiveCardSchemaKey key, size_t index) const
+{
+    const auto& elements = (key == AdaptiveCardSchemaKey::Body) ? body : actions;
+    return GetJsonValue(card, elements.at(index), AdaptiveCardSchemaKeyToString(key) + "[" + std::to_string(index) + "]");
+}
+
+Json::Value AdaptiveCard::ElementSources::GetJsonValue(std::string_view card, std::string_view part, const std::string& partName)
+{
+    try
+    {
+        return ParseUtil::GetJsonValueFromString(part.data(), part.data() + part.size());
+    }
+    catch (const AdaptiveCardParseException& e)
+    {
+        const auto before = card.substr(0, part.data() - card.data());
+        const auto lineStart = before.rfind('\n');
+        const auto line = std::count(before.begin(), before.end(), '\n') + 1;
+        const auto column = (lineStart == std::string_view::npos) ? before.size() + 1 : before.size() - lineStart;
+
+        std::ostringstream message;
+        message << "In " << partName << " (which starts at line " << line << ", column " << column << " of the card): " << e.what();
+        throw AdaptiveCardParseException(e.GetStatusCode(), message.str());
+    }
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByElement(
+    const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByElement(const std::string& jsonString, const std::string& rendererVersion)
+#endif // __ANDROID__
+{
+    ParseContext context;
+    return AdaptiveCard::DeserializeFromStringByElement(jsonString, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByElement(
+    const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByElement(
+    const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
+#endif // __ANDROID__
+{
+    // Scan the top level object. Every member other than the "body" and "actions" arrays is copied verbatim into
+    // cardProperties, which is then parsed as a (small) Json::Value holding just the card level properties. The
+    // body and action arrays are reduced to the source text of each of their elements.
+    JsonStreamReader reader(jsonString.data(), jsonString.data() + jsonString.size());
+    const std::string& bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
+    const std::string& actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
+
+    std::string cardProperties{"{"};
+    std::vector<std::pair<std::string_view, std::string_view>> cardPropertySources;
+    ElementSources elementSources{jsonString, {}, {}, false, false};
+    bool scanned = false;
+
+    if (reader.TryConsume('{'))
+    {
+        bool malformed = false;
+        if (!reader.TryConsume('}'))
+        {
+            do
+            {
+                std::string_view name;
+                if (!reader.ReadRawString(name) || !reader.TryConsume(':'))
+                {
+                    malformed = true;
+                    break;
+                }
+
+                const bool isBody = (name == bodyPropertyName);
+                const bool isActions = (name == actionsPropertyName);
+                if ((isBody || isActions) && reader.Peek() == '[')
+                {
+                    auto& elements = isBody ? elementSources.body : elementSources.actions;
+                    (isBody ? elementSources.hasBody : elementSources.hasActions) = true;
+                    elements.clear();
+
+                    reader.TryConsume('[');
+                    if (!reader.TryConsume(']'))
+                    {
+                        do
+                        {
+                            std::string_view element;
+                            malformed = !reader.SkipValue(element);
+                            elements.push_back(element);
+                        } while (!malformed && reader.TryConsume(','));
+
+                        malformed = malformed || !reader.TryConsume(']');
+                    }
+                    continue;
+                }
+
+                // a later non-array value replaces an earlier array, just as it would in a Json::Value
+                elementSources.hasBody = elementSources.hasBody && !isBody;
+                elementSources.hasActions = elementSources.hasActions && !isActions;
+
+                std::string_view value;
+                if (!reader.SkipValue(value))
+                {
+                    malformed = true;
+                    break;
+                }
+
+                if (cardProperties.size() > 1)
+                {
+                    cardProperties.push_back(',');
+                }
+                cardProperties.push_back('"');
+                cardProperties.append(name);
+                cardProperties.append("\":");
+                cardProperties.append(value);
+                cardPropertySources.emplace_back(name, value);
+            } while (!malformed && reader.TryConsume(','));
+
+            malformed = malformed || !reader.TryConsume('}');
+        }
+        scanned = !malformed && !reader.HasFailed();
+    }
+
+    if (scanned)
+    {
+        cardProperties.push_back('}');
+
+        // The scanner only checks structure, so a property or element may still hold a syntax error. An error in an
+        // element is reported by GetJsonValue as the element is parsed, saying where the element is in the card.
+        Json::Value cardJson;
+        try
+        {
+            cardJson = ParseUtil::GetJsonValueFromString(cardProperties);
+        }
+        catch (const AdaptiveCardParseException&)
+        {
+            // the error is somewhere in cardProperties, which isn't text the caller has ever seen; find the property
+            // it's in so that it can be reported as an element's would be
+            for (const auto& [name, value] : cardPropertySources)
+            {
+                ElementSources::GetJsonValue(jsonString, value, std::string(name));
+            }
+            throw;
+        }
+        return _DeserializeCard(cardJson, rendererVersion, context, &elementSources);
+    }
+
+    // Not something we can split (malformed, or not an object at all). Take the regular path so that callers see
+    // exactly the same errors they would get from DeserializeFromString.
+    return AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, context);
+}
+
+std::vector<std::shared_ptr<ParseResult>> AdaptiveCard::DeserializeBatch(
+    const std::vector<std::string>& jsonStrings,
+    const std::string& rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration,
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration,
+    unsigned int workerCount,
+    std::vector<std::exception_ptr>* errors)
+{
+    std::vector<std::shared_ptr<ParseResult>> results(jsonStrings.size());
+    if (errors != nullptr)
+    {
+        errors->assign(jsonStrings.size(), nullptr);
+    }
+
+    if (jsonStrings.empty())
+    {
+        return results;
+    }
+
+    // create the registrations up front so that every worker shares them rather than building its own
+    if (!elementParserRegistration)
+    {
+        elementParserRegistration = std::make_shared<ElementParserRegistration>();
+    }
+    if (!actionParserRegistration)
+    {
+        actionParserRegistration = std::make_shared<ActionParserRegistration>();
+    }
+
+    if (workerCount == 0)
+    {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workerCount = static_cast<unsigned int>(std::min<size_t>(workerCount, jsonStrings.size()));
+
+    // Cards are handed out one at a time from a shared counter, so a worker that draws cheap cards simply comes back
+    // for more while another is still busy with an expensive one.
+    std::atomic<size_t> nextCard{0};
+    const std::function<void()> worker = [&]() {
+        ParseContext context(elementParserRegistration, actionParserRegistration);
+        for (size_t index = nextCard++; index < jsonStrings.size(); index = nextCard++)
+        {
+            context.Reset();
+            try
+            {
+                results[index] = AdaptiveCard::DeserializeFromString(jsonStrings[index], rendererVersion, context);
+            }
+            catch (...)
+            {
+                if (errors != nullptr)
+                {
+                    (*errors)[index] = std::current_exception();
+                }
+            }
+        }
+    };
+
+    WorkerPool::GetShared().Run(workerCount, worker);
+
+    return results;
+}
+
 Json::Value AdaptiveCard::SerializeToJsonValue() const
 {
     Json::Value root = GetAdditionalProperties();
@@ -364,6 +625,84 @@ Json::Value AdaptiveCard::SerializeToJsonValue() const
     return root;
 }
 
+void AdaptiveCard::SerializeTo(JsonWriter& writer) const
+{
+    writer.BeginObject();
+    writer.Properties(m_additionalProperties);
+    writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type), CardElementTypeToString(CardElementType::AdaptiveCard));
+    writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version), m_version.empty() ? "1.0" : m_version);
+
+    if (!m_fallbackText.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText), m_fallbackText);
+    }
+    if (m_backgroundImage != nullptr && m_backgroundImage->ShouldSerialize())
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage));
+        writer.Value(m_backgroundImage->SerializeToJsonValue());
+    }
+    if (m_refresh != nullptr && m_refresh->ShouldSerialize())
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh));
+        writer.Value(m_refresh->SerializeToJsonValue());
+    }
+    if (m_authentication != nullptr && m_authentication->ShouldSerialize())
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication));
+        writer.Value(m_authentication->SerializeToJsonValue());
+    }
+    if (!m_speak.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak), m_speak);
+    }
+    if (!m_language.empty())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language), m_language);
+    }
+    if (m_style != ContainerStyle::None)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style), ContainerStyleToString(m_style));
+    }
+    if (m_verticalContentAlignment != VerticalContentAlignment::Top)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
+                        VerticalContentAlignmentToString(m_verticalContentAlignment));
+    }
+
+    if (m_minHeight)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight), std::to_string(GetMinHeight()) + "px");
+    }
+
+    if (m_rtl.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl), m_rtl.value_or(false));
+    }
+
+    const HeightType height = GetHeight();
+    if (height != HeightType::Auto)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height), HeightTypeToString(height));
+    }
+
+    writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body));
+    writer.BeginArray();
+    for (const auto& cardElement : m_body)
+    {
+        cardElement->SerializeTo(writer);
+    }
+    writer.EndArray();
+
+    writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
+    writer.BeginArray();
+    for (const auto& action : m_actions)
+    {
+        action->SerializeTo(writer);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
 #ifdef __ANDROID__
 std::shared_ptr<AdaptiveCard> AdaptiveCard::MakeFallbackTextCard(
     const std::string& fallbackText, const std::string& language, const std::string& speak) throw(AdaptiveCards::AdaptiveCardParseException)
@@ -386,7 +725,11 @@ std::shared_ptr<AdaptiveCard> AdaptiveCard::MakeFallbackTextCard(
 
 std::string AdaptiveCard::Serialize() const
 {
-    return ParseUtil::JsonToString(SerializeToJsonValue());
+    JsonWriter writer;
+    SerializeTo(writer);
+    std::string json = writer.TakeString();
+    json += '\n';
+    return json;
 }
 
 std::string AdaptiveCard::GetVersion() const
@@ -545,30 +888,27 @@ void AdaptiveCard::SetRtl(const std::optional<bool>& value)
     m_rtl = value;
 }
 
-void AdaptiveCard::PopulateKnownPropertiesSet()
-{
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema)});
-}
-
 const std::unordered_set<std::string>& AdaptiveCard::GetKnownProperties() const
 {
-    return m_knownProperties;
+    // the same for every card, so built once and shared
+    static const std::unordered_set<std::string> knownProperties{
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema)};
+    return knownProperties;
 }
 
 const Json::Value& AdaptiveCard::GetAdditionalProperties() const
@@ -610,3 +950,140 @@ std::vector<RemoteResourceInformation> AdaptiveCard::GetResourceInformation()
 
     return resourceVector;
 }
+
+std::shared_ptr<AdaptiveCard> AdaptiveCard::Clone() const
+{
+    auto clone = std::make_shared<AdaptiveCard>(*this);
+    if (m_backgroundImage != nullptr)
+    {
+        clone->m_backgroundImage = std::make_shared<BackgroundImage>(*m_backgroundImage);
+    }
+    if (m_refresh != nullptr)
+    {
+        clone->m_refresh = std::make_shared<Refresh>(*m_refresh);
+    }
+    if (m_authentication != nullptr)
+    {
+        clone->m_authentication = std::make_shared<Authentication>(*m_authentication);
+        if (const auto tokenExchangeResource = m_authentication->GetTokenExchangeResource())
+        {
+            clone->m_authentication->SetTokenExchangeResource(std::make_shared<TokenExchangeResource>(*tokenExchangeResource));
+        }
+        for (auto& button : clone->m_authentication->GetButtons())
+        {
+            button = std::make_shared<AuthCardButton>(*button);
+        }
+    }
+    VisitChildren(*clone, [](auto& child) { child->MarkShared(); });
+    return clone;
+}
+
+std::shared_ptr<BaseElement> AdaptiveCard::GetElementById(const std::string& id) const
+{
+    return _FindElement(id, nullptr);
+}
+
+void AdaptiveCard::IndexElements() const
+{
+    m_elementIndex.Store(std::make_shared<const ElementIndex>(*this));
+}
+
+std::shared_ptr<BaseElement> AdaptiveCard::_FindElement(const std::string& id, std::vector<const BaseElement*>* path) const
+{
+    if (const auto index = m_elementIndex.Load())
+    {
+        if (auto element = index->Find(*this, id, path))
+        {
+            return element;
+        }
+
+        // the card may have changed since it was indexed; only if the element is still in it has the index gone stale
+        auto element = ElementIndex::FindByWalking(*this, id, path);
+        if (element != nullptr)
+        {
+            m_elementIndex.Store(std::make_shared<const ElementIndex>(*this));
+        }
+        return element;
+    }
+
+    const auto index = std::make_shared<const ElementIndex>(*this);
+    m_elementIndex.Store(index);
+    return index->Find(*this, id, path);
+}
+
+namespace
+{
+// the elements and actions from a card down to the one being edited, not counting the cards of ShowCard actions
+using ElementPath = std::vector<const BaseElement*>;
+
+// A clone of element, which shares the children of element (and the card of a ShowCard action) with it
+template <typename T>
+std::shared_ptr<T> CloneShared(const T& element)
+{
+    auto clone = std::static_pointer_cast<T>(element.Clone());
+    if constexpr (std::is_same_v<T, BaseActionElement>)
+    {
+        if (clone->GetElementType() == ActionType::ShowCard)
+        {
+            if (const auto card = static_cast<ShowCardAction&>(*clone).GetCard())
+            {
+                card->MarkShared();
+            }
+        }
+    }
+    else
+    {
+        VisitChildren(*clone, [](auto& child) { child->MarkShared(); });
+    }
+    return clone;
+}
+
+std::shared_ptr<BaseElement> EditPathUnder(BaseCardElement& element, const ElementPath& path, size_t depth);
+std::shared_ptr<BaseElement> EditPathUnder(BaseActionElement& action, const ElementPath& path, size_t depth);
+
+// replaces path[depth], a child of parent, by a clone if it's shared, then goes on down the path
+template <typename Parent>
+std::shared_ptr<BaseElement> EditPath(Parent& parent, const ElementPath& path, size_t depth)
+{
+    std::shared_ptr<BaseElement> edited;
+    VisitChildren(parent, [&](auto& child) {
+        if (edited == nullptr && child.get() == path[depth])
+        {
+            if (child->IsShared())
+            {
+                child = CloneShared(*child);
+            }
+            edited = (depth + 1 == path.size()) ? child : EditPathUnder(*child, path, depth + 1);
+        }
+    });
+    return edited;
+}
+
+std::shared_ptr<BaseElement> EditPathUnder(BaseCardElement& element, const ElementPath& path, size_t depth)
+{
+    return EditPath(element, path, depth);
+}
+
+std::shared_ptr<BaseElement> EditPathUnder(BaseActionElement& action, const ElementPath& path, size_t depth)
+{
+    // only ShowCard actions have anything under them
+    auto& showCard = static_cast<ShowCardAction&>(action);
+    auto card = showCard.GetCard();
+    if (card->IsShared())
+    {
+        card = card->Clone();
+        showCard.SetCard(card);
+    }
+    return EditPath(*card, path, depth);
+}
+} // namespace
+
+std::shared_ptr<BaseElement> AdaptiveCard::GetElementForEdit(const std::string& id)
+{
+    ElementPath path;
+    if (_FindElement(id, &path) == nullptr)
+    {
+        return nullptr;
+    }
+    return EditPath(*this, path, 0);
+}
@@ -8,6 +8,7 @@
 #include "ParseResult.h"
 #include "Refresh.h"
 #include "Authentication.h"
+#include "ElementIndex.h"
 
 namespace AdaptiveCards
 {
@@ -122,6 +123,38 @@ public:
 
     std::vector<RemoteResourceInformation> GetResourceInformation();
 
+    // A copy of the card that shares its elements and actions with this one (see BaseElement::Clone). Cloning is
+    // cheap, so a service can parse a card once and clone it for each recipient; to change an element of a clone
+    // without changing it in the original, get it with GetElementForEdit. The elements and actions of the card are
+    // marked shared (see BaseElement::IsShared).
+    std::shared_ptr<AdaptiveCard> Clone() const;
+    // The element or action with the given id (the first in document order, ShowCard cards included), made safe to
+    // change: every element, action and ShowCard card on the way to it that is marked shared is replaced in this card
+    // by a clone first, so only this card sees the change. Whatever isn't on that path stays shared. Returns null if
+    // there is no such element. What isn't marked shared is changed in place, so a caller's std::shared_ptr to it
+    // sees the change.
+    std::shared_ptr<BaseElement> GetElementForEdit(const std::string& id);
+
+    // Whether the card is held by more than one ShowCard action, as the card of a cloned ShowCard action is (see
+    // BaseElement::IsShared).
+    bool IsShared() const
+    {
+        return m_sharing.IsSet();
+    }
+    void MarkShared()
+    {
+        m_sharing.Set();
+    }
+
+    // The element or action with the given id, as FrozenCard::GetElementById finds it (ShowCard cards included), or
+    // null if there is none. Lookups go through an ElementIndex of the card, built by the first of them unless
+    // IndexElements or the parse (see ParseContext::SetBuildsElementIndex) already has. Once the card is indexed, a
+    // lookup takes time in proportion to how deep the element is, not to the size of the card. When the index doesn't
+    // find the element where it was (or has no such id), the card is walked for it instead, as it may have changed
+    // since it was indexed; if the walk finds it, the card is indexed again.
+    std::shared_ptr<BaseElement> GetElementById(const std::string& id) const;
+    void IndexElements() const;
+
     CardElementType GetElementType() const;
 #ifdef __ANDROID__
 #pragma GCC diagnostic ignored "-Wdynamic-exception-spec"
@@ -137,6 +170,11 @@ public:
         const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
     static std::shared_ptr<ParseResult> DeserializeFromString(
         const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
+
+    static std::shared_ptr<ParseResult> DeserializeFromStringByElement(
+        const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
+    static std::shared_ptr<ParseResult> DeserializeFromStringByElement(
+        const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak) throw(AdaptiveCards::AdaptiveCardParseException);
 #else
@@ -148,12 +186,39 @@ public:
     static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
     static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
 
+    // Same result as DeserializeFromString, but never builds a Json::Value for the whole card. The top level of the
+    // card is scanned in place and each element of "body" and "actions" is turned into a Json::Value just before it
+    // is parsed, so the JSON held at any one time is that of the largest top level element rather than the whole
+    // card. The elements are still parsed from Json::Value and the card built is the same, so this saves memory on
+    // cards with large bodies, not parsing work. A syntax error is reported with its line and column in the element or
+    // card property holding it, and where that starts in the card.
+    static std::shared_ptr<ParseResult> DeserializeFromStringByElement(
+        const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
+    static std::shared_ptr<ParseResult> DeserializeFromStringByElement(const std::string& jsonString, const std::string& rendererVersion);
+
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak);
 
 #endif // __ANDROID__
+
+    // Parses every card in jsonStrings, spread across workerCount threads (0 picks one per hardware thread), and
+    // returns the results in the same order as the input. The calling thread is one of them; the others come from
+    // WorkerPool::GetShared(), so threads are only started when a batch needs more than the pool has. The workers
+    // share the given parser registrations (default ones are created if none are supplied); each worker reuses a
+    // single ParseContext for all of the cards it parses. A card that fails to parse leaves a null result. If errors
+    // is supplied, it receives the exception thrown for each such card (and null for every card that parsed).
+    static std::vector<std::shared_ptr<ParseResult>> DeserializeBatch(
+        const std::vector<std::string>& jsonStrings,
+        const std::string& rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration = nullptr,
+        unsigned int workerCount = 0,
+        std::vector<std::exception_ptr>* errors = nullptr);
+
     Json::Value SerializeToJsonValue() const;
     std::string Serialize() const;
+    // writes the same JSON as SerializeToJsonValue into writer, without building the Json::Value
+    void SerializeTo(JsonWriter& writer) const;
 
     const InternalId GetInternalId() const
     {
@@ -162,7 +227,32 @@ public:
 
 private:
     static void _ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
-    void PopulateKnownPropertiesSet();
+
+    // Captured by DeserializeFromStringByElement: the source text of each "body" and "actions" element, as views
+    // into the card's JSON string.
+    struct ElementSources
+    {
+        std::string_view card;
+        std::vector<std::string_view> body;
+        std::vector<std::string_view> actions;
+        bool hasBody;
+        bool hasActions;
+
+        // the element at index in "body" or "actions" (as key says)
+        Json::Value GetJsonValue(AdaptiveCardSchemaKey key, size_t index) const;
+
+        // Parses part, the source text of partName in card. The line and column of a syntax error are given relative
+        // to part, so the error says where in card part starts.
+        static Json::Value GetJsonValue(std::string_view card, std::string_view part, const std::string& partName);
+    };
+
+    // Shared by Deserialize and DeserializeFromStringByElement. When elementSources is supplied, its captured
+    // elements take the place of the "body"/"actions" arrays in json.
+    static std::shared_ptr<ParseResult> _DeserializeCard(
+        const Json::Value& json, const std::string& rendererVersion, ParseContext& context, const ElementSources* elementSources);
+
+    // GetElementById, giving the path to the element as ElementIndex::Find does
+    std::shared_ptr<BaseElement> _FindElement(const std::string& id, std::vector<const BaseElement*>* path) const;
 
     std::string m_version;
     std::string m_fallbackText;
@@ -177,12 +267,14 @@ private:
     unsigned int m_minHeight;
     std::optional<bool> m_rtl;
     InternalId m_internalId;
-    std::unordered_set<std::string> m_knownProperties;
     Json::Value m_additionalProperties;
 
     std::vector<std::shared_ptr<BaseCardElement>> m_body;
     std::vector<std::shared_ptr<BaseActionElement>> m_actions;
 
     std::shared_ptr<BaseActionElement> m_selectAction;
+
+    mutable ElementIndexHolder m_elementIndex;
+    SharingFlag m_sharing;
 };
 } // namespace AdaptiveCards
@@ -22,6 +22,26 @@ Json::Value ShowCardAction::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ShowCardAction::Clone() const
+{
+    return std::make_shared<ShowCardAction>(*this);
+}
+
+void ShowCardAction::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<ShowCardAction>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    BaseActionElement::WriteProperties(writer);
+    writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card));
+    m_card->SerializeTo(writer);
+    writer.EndObject();
+}
+
 std::shared_ptr<AdaptiveCard> ShowCardAction::GetCard() const
 {
     return m_card;
@@ -45,9 +65,7 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContex
 {
     std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(context, json);
 
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
-
-    auto parseResult = AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), "", context);
+    auto parseResult = AdaptiveCard::Deserialize(ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Card), "", context);
 
     auto showCardWarnings = parseResult->GetWarnings();
     auto warningsEnd = context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
@@ -64,7 +82,8 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::DeserializeFromString(P
 
 void ShowCardAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::Card});
+    m_knownProperties = &knownProperties;
 }
 
 void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -125,6 +125,14 @@ void StyledCollectionElement::SetSelectAction(const std::shared_ptr<BaseActionEl
     m_selectAction = action;
 }
 
+void StyledCollectionElement::CopyBackgroundImage()
+{
+    if (m_backgroundImage != nullptr)
+    {
+        m_backgroundImage = std::make_shared<BackgroundImage>(*m_backgroundImage);
+    }
+}
+
 Json::Value StyledCollectionElement::SerializeToJsonValue() const
 {
     Json::Value root = CollectionCoreElement::SerializeToJsonValue();
@@ -163,3 +171,42 @@ Json::Value StyledCollectionElement::SerializeToJsonValue() const
 
     return root;
 }
+
+void StyledCollectionElement::WriteProperties(JsonWriter& writer) const
+{
+    CollectionCoreElement::WriteProperties(writer);
+
+    if (m_selectAction != nullptr)
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction));
+        m_selectAction->SerializeTo(writer);
+    }
+
+    if (m_backgroundImage != nullptr && !m_backgroundImage->GetUrl().empty())
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage));
+        writer.Value(m_backgroundImage->SerializeToJsonValue());
+    }
+
+    if (GetStyle() != ContainerStyle::None)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style), ContainerStyleToString(GetStyle()));
+    }
+
+    if (GetVerticalContentAlignment().has_value())
+    {
+        writer.Property(
+            AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
+            VerticalContentAlignmentToString(GetVerticalContentAlignment().value_or(VerticalContentAlignment::Top)));
+    }
+
+    if (GetBleed())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed), true);
+    }
+
+    if (m_minHeight)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight), std::to_string(GetMinHeight()) + "px");
+    }
+}
@@ -72,6 +72,11 @@ public:
     template <typename T>
     static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& value);
 
+protected:
+    void WriteProperties(JsonWriter& writer) const;
+    // for Clone: gives this its own copy of the background image
+    void CopyBackgroundImage();
+
 private:
     // Applies padding flag When appropriate
     void ConfigPadding(const AdaptiveCards::ParseContext& context);
@@ -58,11 +58,40 @@ Json::Value SubmitAction::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> SubmitAction::Clone() const
+{
+    return std::make_shared<SubmitAction>(*this);
+}
+
+void SubmitAction::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<SubmitAction>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    BaseActionElement::WriteProperties(writer);
+
+    if (!m_dataJson.empty())
+    {
+        writer.Key(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data));
+        writer.Value(m_dataJson);
+    }
+
+    if (m_associatedInputs != AssociatedInputs::Auto)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs), AssociatedInputsToString(m_associatedInputs));
+    }
+    writer.EndObject();
+}
+
 std::shared_ptr<BaseActionElement> SubmitActionParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::shared_ptr<SubmitAction> submitAction = BaseActionElement::Deserialize<SubmitAction>(context, json);
 
-    submitAction->SetDataJson(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
+    submitAction->SetDataJson(ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Data));
     submitAction->SetAssociatedInputs(ParseUtil::GetEnumValue<AssociatedInputs>(
         json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsFromString));
 
@@ -76,7 +105,10 @@ std::shared_ptr<BaseActionElement> SubmitActionParser::DeserializeFromString(Par
 
 void SubmitAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Data,
+             AdaptiveCardSchemaKey::AssociatedInputs});
+    m_knownProperties = &knownProperties;
 }
@@ -27,6 +27,8 @@ public:
     virtual void SetAssociatedInputs(const AssociatedInputs value);
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
+    void SerializeTo(JsonWriter& writer) const override;
 
 private:
     void PopulateKnownPropertiesSet();
@@ -15,14 +15,17 @@ Table::Table() :
 
 void Table::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FirstRowAsHeaders),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::GridStyle),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ShowGridLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Columns,
+             AdaptiveCardSchemaKey::FirstRowAsHeaders,
+             AdaptiveCardSchemaKey::GridStyle,
+             AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+             AdaptiveCardSchemaKey::Rows,
+             AdaptiveCardSchemaKey::ShowGridLines,
+             AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 bool Table::GetShowGridLines() const
@@ -167,13 +170,20 @@ Json::Value Table::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> Table::Clone() const
+{
+    auto clone = std::make_shared<Table>(*this);
+    CopyEach(clone->m_columnDefinitions);
+    return clone;
+}
+
 std::shared_ptr<BaseCardElement> TableParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::Table);
 
     std::shared_ptr<Table> table = CollectionCoreElement::Deserialize<Table>(context, json);
 
-    if (const auto& columnsArray = ParseUtil::GetArray(json, AdaptiveCardSchemaKey::Columns, false); !columnsArray.empty())
+    if (const auto& columnsArray = ParseUtil::GetArrayRef(json, AdaptiveCardSchemaKey::Columns, false); !columnsArray.empty())
     {
         auto& columns = table->GetColumns();
         for (const auto& columnJson : columnsArray)
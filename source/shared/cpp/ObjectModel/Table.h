@@ -21,6 +21,7 @@ public:
     virtual ~Table() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
     bool GetShowGridLines() const;
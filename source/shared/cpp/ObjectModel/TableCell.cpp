@@ -12,6 +12,13 @@ TableCell::TableCell() : Container(CardElementType::TableCell)
 {
 }
 
+std::shared_ptr<BaseElement> TableCell::Clone() const
+{
+    auto clone = std::make_shared<TableCell>(*this);
+    clone->CopyBackgroundImage();
+    return clone;
+}
+
 std::shared_ptr<TableCell> TableCell::DeserializeTableCell(ParseContext& context, const Json::Value& value)
 {
     const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
@@ -19,6 +19,8 @@ public:
     TableCell& operator=(TableCell&&) = default;
     virtual ~TableCell() = default;
 
+    std::shared_ptr<BaseElement> Clone() const override;
+
     static std::shared_ptr<TableCell> DeserializeTableCellFromString(ParseContext& context, const std::string& root);
     static std::shared_ptr<TableCell> DeserializeTableCell(ParseContext& context, const Json::Value& root);
 };
@@ -7,9 +7,28 @@
 
 namespace AdaptiveCards
 {
+namespace
+{
+    ColumnWidth ParseTableColumnWidth(const std::optional<unsigned int>& width, const std::optional<unsigned int>& pixelWidth)
+    {
+        if (pixelWidth.has_value())
+        {
+            return (*pixelWidth != 0) ? ColumnWidth{ColumnWidthType::Pixels, 0, *pixelWidth} : ColumnWidth{};
+        }
+
+        if (width.has_value())
+        {
+            return (*width != 0) ? ColumnWidth{ColumnWidthType::Weighted, static_cast<double>(*width), 0} : ColumnWidth{};
+        }
+
+        return {ColumnWidthType::Stretch, 1, 0};
+    }
+}
+
 TableColumnDefinition::TableColumnDefinition() :
     m_horizontalCellContentAlignment(HorizontalAlignment::Left),
-    m_verticalCellContentAlignment(VerticalContentAlignment::Top), m_pixelWidth{}, m_width{}
+    m_verticalCellContentAlignment(VerticalContentAlignment::Top), m_pixelWidth{}, m_width{},
+    m_parsedWidth{ParseTableColumnWidth(m_width, m_pixelWidth)}
 {
 }
 
@@ -78,6 +97,7 @@ void TableColumnDefinition::SetWidth(const std::optional<unsigned int>& value)
 {
     m_pixelWidth = {};
     m_width = value;
+    m_parsedWidth = ParseTableColumnWidth(m_width, m_pixelWidth);
 }
 
 std::optional<unsigned int> TableColumnDefinition::GetPixelWidth() const
@@ -89,6 +109,12 @@ void TableColumnDefinition::SetPixelWidth(const std::optional<unsigned int>& val
 {
     m_width = {};
     m_pixelWidth = value;
+    m_parsedWidth = ParseTableColumnWidth(m_width, m_pixelWidth);
+}
+
+const ColumnWidth& TableColumnDefinition::GetParsedWidth() const
+{
+    return m_parsedWidth;
 }
 
 std::shared_ptr<TableColumnDefinition> TableColumnDefinition::Deserialize(ParseContext& context, const Json::Value& json)
@@ -100,7 +126,7 @@ std::shared_ptr<TableColumnDefinition> TableColumnDefinition::Deserialize(ParseC
     tableColumnDefinition->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
         json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
 
-    if (const auto& widthValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Width, false); !widthValue.empty())
+    if (const auto& widthValue = ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Width, false); !widthValue.empty())
     {
         if (widthValue.isInt())
         {
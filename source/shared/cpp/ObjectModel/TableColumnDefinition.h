@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "ColumnWidth.h"
+
 namespace AdaptiveCards
 {
 class AdaptiveCardParseWarning;
@@ -29,6 +31,9 @@ public:
     std::optional<unsigned int> GetPixelWidth() const;
     void SetPixelWidth(const std::optional<unsigned int>& value);
 
+    // the width as renderers should lay it out: unset is Stretch, and a weight of 0 is Auto
+    const ColumnWidth& GetParsedWidth() const;
+
     static std::shared_ptr<AdaptiveCards::TableColumnDefinition> Deserialize(ParseContext& context, const Json::Value& root);
     static std::shared_ptr<AdaptiveCards::TableColumnDefinition> DeserializeFromString(ParseContext& context, const std::string& jsonString);
 
@@ -38,5 +43,6 @@ private:
 
     std::optional<unsigned int> m_pixelWidth;
     std::optional<unsigned int> m_width;
+    ColumnWidth m_parsedWidth;
 };
 } // namespace AdaptiveCards
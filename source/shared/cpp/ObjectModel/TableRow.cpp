@@ -18,12 +18,15 @@ TableRow::TableRow() :
 
 void TableRow::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Cells,
+             AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+             AdaptiveCardSchemaKey::Rtl,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 std::vector<std::shared_ptr<TableCell>>& TableRow::GetCells()
@@ -100,6 +103,11 @@ Json::Value TableRow::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> TableRow::Clone() const
+{
+    return std::make_shared<TableRow>(*this);
+}
+
 std::shared_ptr<TableRow> TableRow::DeserializeTableRowFromString(ParseContext& context, const std::string& json)
 {
     return DeserializeTableRow(context, ParseUtil::GetJsonValueFromString(json));
@@ -21,6 +21,7 @@ public:
     virtual ~TableRow() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::vector<std::shared_ptr<AdaptiveCards::TableCell>>& GetCells();
     const std::vector<std::shared_ptr<AdaptiveCards::TableCell>>& GetCells() const;
@@ -52,6 +52,49 @@ Json::Value TextBlock::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> TextBlock::Clone() const
+{
+    auto clone = std::make_shared<TextBlock>(*this);
+    clone->m_textElementProperties = std::make_shared<TextElementProperties>(*m_textElementProperties);
+    return clone;
+}
+
+void TextBlock::SerializeTo(JsonWriter& writer) const
+{
+    if (!IsExactly<TextBlock>())
+    {
+        BaseElement::SerializeTo(writer);
+        return;
+    }
+
+    writer.BeginObject();
+    BaseCardElement::WriteProperties(writer);
+    m_textElementProperties->WriteProperties(writer);
+
+    if (m_hAlignment.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
+                        HorizontalAlignmentToString(m_hAlignment.value_or(HorizontalAlignment::Left)));
+    }
+
+    if (m_maxLines != 0)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines), m_maxLines);
+    }
+
+    if (m_wrap)
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap), true);
+    }
+
+    if (m_textStyle.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
+                        TextStyleToString(m_textStyle.value_or(TextStyle::Default)));
+    }
+    writer.EndObject();
+}
+
 std::string TextBlock::GetText() const
 {
     return m_textElementProperties->GetText();
@@ -62,11 +105,31 @@ void TextBlock::SetText(const std::string& value)
     m_textElementProperties->SetText(value);
 }
 
-DateTimePreparser TextBlock::GetTextForDateParsing() const
+std::shared_ptr<const DateTimePreparser> TextBlock::GetTextForDateParsing() const
 {
     return m_textElementProperties->GetTextForDateParsing();
 }
 
+std::shared_ptr<const MarkDownTransformResult> TextBlock::GetMarkDownResult(const std::string& text) const
+{
+    return m_textElementProperties->GetMarkDownResult(text);
+}
+
+void TextBlock::SetTextMemoizationEnabled(bool enabled)
+{
+    m_textElementProperties->SetMemoizationEnabled(enabled);
+}
+
+bool TextBlock::IsTextMemoizationEnabled() const
+{
+    return m_textElementProperties->IsMemoizationEnabled();
+}
+
+void TextBlock::FreezeText()
+{
+    m_textElementProperties->Freeze();
+}
+
 std::optional<TextStyle> TextBlock::GetStyle() const
 {
     return m_textStyle;
@@ -190,11 +253,15 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
 
 void TextBlock::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
-
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const std::unordered_set<std::string> knownProperties = [this]() {
+        auto properties = ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Wrap,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::MaxLines,
+             AdaptiveCardSchemaKey::HorizontalAlignment});
+        m_textElementProperties->PopulateKnownPropertiesSet(properties);
+        return properties;
+    }();
+    m_knownProperties = &knownProperties;
 }
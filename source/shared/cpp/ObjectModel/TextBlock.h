@@ -25,10 +25,18 @@ public:
     ~TextBlock() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
+    void SerializeTo(JsonWriter& writer) const override;
 
     std::string GetText() const;
     void SetText(const std::string& value);
-    DateTimePreparser GetTextForDateParsing() const;
+    std::shared_ptr<const DateTimePreparser> GetTextForDateParsing() const;
+    std::shared_ptr<const MarkDownTransformResult> GetMarkDownResult(const std::string& text) const;
+    // see TextElementProperties::SetMemoizationEnabled
+    void SetTextMemoizationEnabled(bool enabled);
+    bool IsTextMemoizationEnabled() const;
+    // see TextElementProperties::Freeze
+    void FreezeText();
 
     std::optional<TextStyle> GetStyle() const;
     void SetStyle(const std::optional<TextStyle> value);
@@ -2,27 +2,74 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include <iomanip>
-#include <regex>
 #include <iostream>
 #include <codecvt>
 #include "ParseContext.h"
 #include "TextElementProperties.h"
 #include "DateTimePreparser.h"
+#include "MarkDownParser.h"
 #include "ParseUtil.h"
 
 using namespace AdaptiveCards;
 
-TextElementProperties::TextElementProperties() : m_language()
+namespace
+{
+std::atomic<unsigned long long> s_dateParsingHits{0};
+std::atomic<unsigned long long> s_dateParsingMisses{0};
+std::atomic<unsigned long long> s_markDownHits{0};
+std::atomic<unsigned long long> s_markDownMisses{0};
+
+std::shared_ptr<const MarkDownTransformResult> TransformMarkDown(const std::string& text)
+{
+    MarkDownParser parser(text);
+    auto result = std::make_shared<MarkDownTransformResult>();
+    result->text = text;
+    result->html = parser.TransformToHtml();
+    result->hasHtmlTags = parser.HasHtmlTags();
+    result->isEscaped = parser.IsEscaped();
+    return result;
+}
+} // namespace
+
+TextElementProperties::TextElementProperties() : m_language(), m_isMemoizationEnabled(false), m_isFrozen(false)
 {
 }
 
 TextElementProperties::TextElementProperties(const TextStyleConfig& config, const std::string& text, const std::string& language) :
     m_textSize(config.size), m_textWeight(config.weight), m_fontType(config.fontType), m_textColor(config.color),
-    m_isSubtle(config.isSubtle), m_language(language)
+    m_isSubtle(config.isSubtle), m_language(language), m_isMemoizationEnabled(false), m_isFrozen(false)
 {
     SetText(text);
 }
 
+TextElementProperties::TextElementProperties(const TextElementProperties& other) :
+    m_text(other.m_text), m_textSize(other.m_textSize), m_textWeight(other.m_textWeight), m_fontType(other.m_fontType),
+    m_textColor(other.m_textColor), m_isSubtle(other.m_isSubtle), m_language(other.m_language),
+    m_memoizedDateParsing(std::atomic_load(&other.m_memoizedDateParsing)),
+    m_memoizedMarkDown(std::atomic_load(&other.m_memoizedMarkDown)),
+    m_isMemoizationEnabled(other.m_isMemoizationEnabled), m_isFrozen(other.m_isFrozen)
+{
+}
+
+TextElementProperties& TextElementProperties::operator=(const TextElementProperties& other)
+{
+    if (this != &other)
+    {
+        m_text = other.m_text;
+        m_textSize = other.m_textSize;
+        m_textWeight = other.m_textWeight;
+        m_fontType = other.m_fontType;
+        m_textColor = other.m_textColor;
+        m_isSubtle = other.m_isSubtle;
+        m_language = other.m_language;
+        std::atomic_store(&m_memoizedDateParsing, std::atomic_load(&other.m_memoizedDateParsing));
+        std::atomic_store(&m_memoizedMarkDown, std::atomic_load(&other.m_memoizedMarkDown));
+        m_isMemoizationEnabled = other.m_isMemoizationEnabled;
+        m_isFrozen = other.m_isFrozen;
+    }
+    return *this;
+}
+
 Json::Value TextElementProperties::SerializeToJsonValue(Json::Value& root) const
 {
     if (m_textSize.has_value())
@@ -59,6 +106,40 @@ Json::Value TextElementProperties::SerializeToJsonValue(Json::Value& root) const
     return root;
 }
 
+void TextElementProperties::WriteProperties(JsonWriter& writer) const
+{
+    if (m_textSize.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
+                        TextSizeToString(m_textSize.value_or(TextSize::Default)));
+    }
+
+    if (m_textColor.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color),
+                        ForegroundColorToString(m_textColor.value_or(ForegroundColor::Default)));
+    }
+
+    if (m_textWeight.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Weight),
+                        TextWeightToString(m_textWeight.value_or(TextWeight::Default)));
+    }
+
+    if (m_fontType.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FontType),
+                        FontTypeToString(m_fontType.value_or(FontType::Default)));
+    }
+
+    if (m_isSubtle.has_value())
+    {
+        writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsSubtle), m_isSubtle.value_or(false));
+    }
+
+    writer.Property(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Text), m_text);
+}
+
 std::string TextElementProperties::GetText() const
 {
     return m_text;
@@ -67,46 +148,144 @@ std::string TextElementProperties::GetText() const
 // Convert some HTML entities into characters
 std::string TextElementProperties::_ProcessHTMLEntities(const std::string& input)
 {
-    static const std::regex htmlEntities("&(amp|quot|lt|gt|nbsp);");
+    // find() is a memchr underneath, so text without entities only costs a scan and a copy
+    size_t ampersand = input.find('&');
+    if (ampersand == std::string::npos)
+    {
+        return input;
+    }
+
+    // &nbsp; becomes U+00A0, encoded as UTF-8
+    static constexpr std::pair<std::string_view, std::string_view> htmlEntities[] = {
+        {"&amp;", "&"}, {"&quot;", "\""}, {"&lt;", "<"}, {"&gt;", ">"}, {"&nbsp;", "\xC2\xA0"}};
 
-    if (std::regex_search(input, htmlEntities))
+    // entities are decoded in a single pass, so "&amp;lt;" becomes "&lt;" rather than "<"
+    std::string output;
+    output.reserve(input.size());
+    size_t copiedUpTo = 0;
+    const std::string_view inputView{input};
+    while (ampersand != std::string::npos)
     {
-        // this needs to be kept up to date with htmlEntities above
-        // clang-format off
-        static const std::vector<std::pair<std::regex, std::string>> replacements =
-            {
-                { std::regex("&quot;"), "\"" },
-                { std::regex("&lt;"), "<" },
-                { std::regex("&gt;"), ">" },
-                { std::regex("&nbsp;"), " " },
-                { std::regex("&amp;"), "&" } // amp must be last
-            };
-        // clang-format on
+        const auto entity = std::find_if(std::begin(htmlEntities), std::end(htmlEntities), [&](const auto& htmlEntity) {
+            return inputView.compare(ampersand, htmlEntity.first.size(), htmlEntity.first) == 0;
+        });
 
-        // handle entities
-        std::string output = input;
+        if (entity != std::end(htmlEntities))
+        {
+            output.append(input, copiedUpTo, ampersand - copiedUpTo);
+            output += entity->second;
+            copiedUpTo = ampersand + entity->first.size();
+            ampersand = input.find('&', copiedUpTo);
+        }
+        else
+        {
+            ampersand = input.find('&', ampersand + 1);
+        }
+    }
+
+    output.append(input, copiedUpTo, std::string::npos);
+    return output;
+}
+
+void TextElementProperties::SetText(const std::string& value)
+{
+    m_text = _ProcessHTMLEntities(value);
+    _ClearMemoizedResults();
+}
+
+std::shared_ptr<const DateTimePreparser> TextElementProperties::GetTextForDateParsing() const
+{
+    if (!m_isFrozen && !m_isMemoizationEnabled)
+    {
+        return std::make_shared<const DateTimePreparser>(m_text);
+    }
+
+    auto memoized = std::atomic_load(&m_memoizedDateParsing);
+    if (memoized)
+    {
+        s_dateParsingHits.fetch_add(1, std::memory_order_relaxed);
+        return memoized;
+    }
+
+    // renderers on other threads may be making it too; only the first one made is kept, so that they all share it
+    s_dateParsingMisses.fetch_add(1, std::memory_order_relaxed);
+    const auto preparser = std::make_shared<const DateTimePreparser>(m_text);
+    if (std::atomic_compare_exchange_strong(&m_memoizedDateParsing, &memoized, preparser))
+    {
+        return preparser;
+    }
+    return memoized;
+}
 
-        for (const auto& replacement : replacements)
+std::shared_ptr<const MarkDownTransformResult> TextElementProperties::GetMarkDownResult(const std::string& text) const
+{
+    const bool isMemoizationEnabled = m_isFrozen || m_isMemoizationEnabled;
+    if (isMemoizationEnabled)
+    {
+        // a renderer formats dates the same way each time, so only the last text needs keeping
+        auto memoized = std::atomic_load(&m_memoizedMarkDown);
+        if (memoized && memoized->text == text)
         {
-            output = std::regex_replace(output, replacement.first, replacement.second);
+            s_markDownHits.fetch_add(1, std::memory_order_relaxed);
+            return memoized;
         }
+        s_markDownMisses.fetch_add(1, std::memory_order_relaxed);
+    }
 
-        return output;
+    auto result = TransformMarkDown(text);
+    if (isMemoizationEnabled)
+    {
+        std::atomic_store(&m_memoizedMarkDown, result);
     }
-    else
+    return result;
+}
+
+void TextElementProperties::Freeze()
+{
+    m_isFrozen = true;
+
+    // without dates, the renderer has nothing to format, so the markdown it asks for is that of the text itself
+    if (!GetTextForDateParsing()->HasDateTokens())
     {
-        return input;
+        std::atomic_store(&m_memoizedMarkDown, TransformMarkDown(m_text));
     }
 }
 
-void TextElementProperties::SetText(const std::string& value)
+void TextElementProperties::SetMemoizationEnabled(bool enabled)
 {
-    m_text = _ProcessHTMLEntities(value);
+    m_isMemoizationEnabled = enabled;
+}
+
+bool TextElementProperties::IsMemoizationEnabled() const
+{
+    return m_isMemoizationEnabled;
+}
+
+TextMemoizationCounters TextElementProperties::GetMemoizationCounters()
+{
+    TextMemoizationCounters counters;
+    counters.dateParsingHits = s_dateParsingHits.load(std::memory_order_relaxed);
+    counters.dateParsingMisses = s_dateParsingMisses.load(std::memory_order_relaxed);
+    counters.markDownHits = s_markDownHits.load(std::memory_order_relaxed);
+    counters.markDownMisses = s_markDownMisses.load(std::memory_order_relaxed);
+    return counters;
+}
+
+void TextElementProperties::ResetMemoizationCounters()
+{
+    s_dateParsingHits.store(0, std::memory_order_relaxed);
+    s_dateParsingMisses.store(0, std::memory_order_relaxed);
+    s_markDownHits.store(0, std::memory_order_relaxed);
+    s_markDownMisses.store(0, std::memory_order_relaxed);
 }
 
-DateTimePreparser TextElementProperties::GetTextForDateParsing() const
+// the memoized results are for the old text and language; they are dropped rather than cleared, as copies of
+// this may still be sharing them
+void TextElementProperties::_ClearMemoizedResults()
 {
-    return DateTimePreparser(m_text);
+    m_isFrozen = false;
+    std::atomic_store(&m_memoizedDateParsing, std::shared_ptr<const DateTimePreparser>());
+    std::atomic_store(&m_memoizedMarkDown, std::shared_ptr<const MarkDownTransformResult>());
 }
 
 std::optional<TextSize> TextElementProperties::GetTextSize() const
@@ -167,6 +346,7 @@ const std::string& TextElementProperties::GetLanguage() const
 void TextElementProperties::SetLanguage(const std::string& value)
 {
     m_language = value;
+    _ClearMemoizedResults();
 }
 
 void TextElementProperties::Deserialize(ParseContext& context, const Json::Value& json)
@@ -10,22 +10,59 @@
 
 namespace AdaptiveCards
 {
+// what MarkDownParser made of a text, as TextElementProperties::GetMarkDownResult keeps it
+struct MarkDownTransformResult
+{
+    // the text it was made from
+    std::string text;
+    std::string html;
+    bool hasHtmlTags = false;
+    bool isEscaped = false;
+};
+
+// hits and misses of the memoized text processing since the counters were last reset
+struct TextMemoizationCounters
+{
+    unsigned long long dateParsingHits = 0;
+    unsigned long long dateParsingMisses = 0;
+    unsigned long long markDownHits = 0;
+    unsigned long long markDownMisses = 0;
+};
+
 class TextElementProperties
 {
 public:
     TextElementProperties();
     TextElementProperties(const TextStyleConfig&, const std::string&, const std::string&);
-    TextElementProperties(const TextElementProperties&) = default;
+    // copying reads the memoized results atomically, as a renderer may be storing them meanwhile
+    TextElementProperties(const TextElementProperties&);
     TextElementProperties(TextElementProperties&&) = default;
-    TextElementProperties& operator=(const TextElementProperties&) = default;
+    TextElementProperties& operator=(const TextElementProperties&);
     TextElementProperties& operator=(TextElementProperties&&) = default;
     virtual ~TextElementProperties() = default;
 
     virtual Json::Value SerializeToJsonValue(Json::Value& root) const;
+    // writes what TextElementProperties::SerializeToJsonValue adds to root, for TextBlock::SerializeTo
+    void WriteProperties(JsonWriter& writer) const;
 
     std::string GetText() const;
     void SetText(const std::string& value);
-    DateTimePreparser GetTextForDateParsing() const;
+    // the text split into dates and the text between them; when memoization is on (or the element is frozen), it is
+    // made the first time it is asked for and kept until the text or language changes
+    std::shared_ptr<const DateTimePreparser> GetTextForDateParsing() const;
+    // markdown of text, which is the text of this element once the renderer has formatted its dates
+    std::shared_ptr<const MarkDownTransformResult> GetMarkDownResult(const std::string& text) const;
+
+    // When memoization is on, GetTextForDateParsing and GetMarkDownResult keep what they last computed until the text
+    // or language changes, so rendering this element again doesn't process its text again. It is off by default.
+    void SetMemoizationEnabled(bool enabled);
+    bool IsMemoizationEnabled() const;
+    static TextMemoizationCounters GetMemoizationCounters();
+    static void ResetMemoizationCounters();
+
+    // Processes the text now, for FrozenCard, and memoizes the results for this element whether memoization is on or
+    // not. Nothing else may be using the element meanwhile; changing the text or language afterwards undoes it.
+    void Freeze();
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
@@ -50,6 +87,7 @@ public:
 
 private:
     static std::string _ProcessHTMLEntities(const std::string& input);
+    void _ClearMemoizedResults();
 
     std::string m_text;
     std::optional<TextSize> m_textSize;
@@ -58,5 +96,12 @@ private:
     std::optional<ForegroundColor> m_textColor;
     std::optional<bool> m_isSubtle;
     std::string m_language;
+
+    // memoized results; they are never changed once made, only replaced, so copies of this can share them and
+    // renderers on different threads can read them
+    mutable std::shared_ptr<const DateTimePreparser> m_memoizedDateParsing;
+    mutable std::shared_ptr<const MarkDownTransformResult> m_memoizedMarkDown;
+    bool m_isMemoizationEnabled;
+    bool m_isFrozen;
 };
 } // namespace AdaptiveCards
@@ -56,6 +56,11 @@ Json::Value TextInput::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> TextInput::Clone() const
+{
+    return std::make_shared<TextInput>(*this);
+}
+
 std::string TextInput::GetPlaceholder() const
 {
     return m_placeholder;
@@ -163,10 +168,13 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
 
 void TextInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Placeholder,
+             AdaptiveCardSchemaKey::Value,
+             AdaptiveCardSchemaKey::IsMultiline,
+             AdaptiveCardSchemaKey::MaxLength,
+             AdaptiveCardSchemaKey::TextInput});
+    m_knownProperties = &knownProperties;
 }
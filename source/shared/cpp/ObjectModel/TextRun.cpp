@@ -14,7 +14,12 @@ TextRun::TextRun() :
 
 void TextRun::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    static const std::unordered_set<std::string> knownProperties = [this]() {
+        auto properties = *m_knownProperties;
+        m_textElementProperties->PopulateKnownPropertiesSet(properties);
+        return properties;
+    }();
+    m_knownProperties = &knownProperties;
 }
 
 Json::Value TextRun::SerializeToJsonValue() const
@@ -36,6 +41,13 @@ Json::Value TextRun::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<Inline> TextRun::Clone() const
+{
+    auto clone = std::make_shared<TextRun>(*this);
+    clone->m_textElementProperties = std::make_shared<RichTextElementProperties>(*m_textElementProperties);
+    return clone;
+}
+
 std::string TextRun::GetText() const
 {
     return m_textElementProperties->GetText();
@@ -46,11 +58,31 @@ void TextRun::SetText(const std::string& value)
     m_textElementProperties->SetText(value);
 }
 
-DateTimePreparser TextRun::GetTextForDateParsing() const
+std::shared_ptr<const DateTimePreparser> TextRun::GetTextForDateParsing() const
 {
     return m_textElementProperties->GetTextForDateParsing();
 }
 
+std::shared_ptr<const MarkDownTransformResult> TextRun::GetMarkDownResult(const std::string& text) const
+{
+    return m_textElementProperties->GetMarkDownResult(text);
+}
+
+void TextRun::SetTextMemoizationEnabled(bool enabled)
+{
+    m_textElementProperties->SetMemoizationEnabled(enabled);
+}
+
+bool TextRun::IsTextMemoizationEnabled() const
+{
+    return m_textElementProperties->IsMemoizationEnabled();
+}
+
+void TextRun::FreezeText()
+{
+    m_textElementProperties->Freeze();
+}
+
 std::optional<TextSize> TextRun::GetTextSize() const
 {
     return m_textElementProperties->GetTextSize();
@@ -178,7 +210,7 @@ std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::
         inlineTextRun->SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
         inlineTextRun->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-        HandleUnknownProperties(json, inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
+        HandleUnknownProperties(json, *inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
     }
 
     return inlineTextRun;
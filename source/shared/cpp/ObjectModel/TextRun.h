@@ -20,12 +20,19 @@ public:
     ~TextRun() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<Inline> Clone() const override;
 
     static std::shared_ptr<Inline> Deserialize(ParseContext& context, const Json::Value& root);
 
     std::string GetText() const;
     void SetText(const std::string& value);
-    DateTimePreparser GetTextForDateParsing() const;
+    std::shared_ptr<const DateTimePreparser> GetTextForDateParsing() const;
+    std::shared_ptr<const MarkDownTransformResult> GetMarkDownResult(const std::string& text) const;
+    // see TextElementProperties::SetMemoizationEnabled
+    void SetTextMemoizationEnabled(bool enabled);
+    bool IsTextMemoizationEnabled() const;
+    // see TextElementProperties::Freeze
+    void FreezeText();
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
@@ -39,6 +39,11 @@ Json::Value TimeInput::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> TimeInput::Clone() const
+{
+    return std::make_shared<TimeInput>(*this);
+}
+
 std::string TimeInput::GetMax() const
 {
     return m_max;
@@ -100,9 +105,12 @@ std::shared_ptr<BaseCardElement> TimeInputParser::DeserializeFromString(ParseCon
 
 void TimeInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Max,
+             AdaptiveCardSchemaKey::Min,
+             AdaptiveCardSchemaKey::Placeholder,
+             AdaptiveCardSchemaKey::Value});
+    m_knownProperties = &knownProperties;
 }
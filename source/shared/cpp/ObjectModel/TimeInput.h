@@ -19,6 +19,7 @@ public:
     ~TimeInput() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::string GetMax() const;
     void SetMax(const std::string& value);
@@ -42,6 +42,11 @@ Json::Value ToggleInput::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ToggleInput::Clone() const
+{
+    return std::make_shared<ToggleInput>(*this);
+}
+
 std::string ToggleInput::GetTitle() const
 {
     return m_title;
@@ -113,10 +118,13 @@ std::shared_ptr<BaseCardElement> ToggleInputParser::DeserializeFromString(ParseC
 
 void ToggleInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Title,
+             AdaptiveCardSchemaKey::Value,
+             AdaptiveCardSchemaKey::ValueOn,
+             AdaptiveCardSchemaKey::ValueOff,
+             AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
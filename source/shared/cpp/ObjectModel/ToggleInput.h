@@ -19,6 +19,7 @@ public:
     ~ToggleInput() = default;
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
     std::string GetTitle() const;
     void SetTitle(const std::string& value);
@@ -34,6 +34,13 @@ Json::Value ToggleVisibilityAction::SerializeToJsonValue() const
     return root;
 }
 
+std::shared_ptr<BaseElement> ToggleVisibilityAction::Clone() const
+{
+    auto clone = std::make_shared<ToggleVisibilityAction>(*this);
+    CopyEach(clone->m_targetElements);
+    return clone;
+}
+
 std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::shared_ptr<ToggleVisibilityAction> toggleVisibilityAction =
@@ -53,5 +60,7 @@ std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::DeserializeFrom
 
 void ToggleVisibilityAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements)});
+    static const std::unordered_set<std::string> knownProperties =
+        ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::TargetElements});
+    m_knownProperties = &knownProperties;
 }
@@ -20,6 +20,7 @@ public:
     std::vector<std::shared_ptr<ToggleVisibilityTarget>>& GetTargetElements();
 
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 
 private:
     void PopulateKnownPropertiesSet();
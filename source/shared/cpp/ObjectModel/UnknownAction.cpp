@@ -14,6 +14,11 @@ Json::Value AdaptiveCards::UnknownAction::SerializeToJsonValue() const
     return GetAdditionalProperties();
 }
 
+std::shared_ptr<BaseElement> UnknownAction::Clone() const
+{
+    return std::make_shared<UnknownAction>(*this);
+}
+
 std::shared_ptr<BaseActionElement> UnknownActionParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::string actualType = ParseUtil::GetTypeAsString(json);
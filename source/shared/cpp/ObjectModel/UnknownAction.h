@@ -14,6 +14,7 @@ class UnknownAction : public BaseActionElement
 public:
     UnknownAction();
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 };
 
 class UnknownActionParser : public ActionElementParser
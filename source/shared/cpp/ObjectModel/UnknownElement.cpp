@@ -37,3 +37,8 @@ Json::Value UnknownElement::SerializeToJsonValue() const
 {
     return GetAdditionalProperties();
 }
+
+std::shared_ptr<BaseElement> UnknownElement::Clone() const
+{
+    return std::make_shared<UnknownElement>(*this);
+}
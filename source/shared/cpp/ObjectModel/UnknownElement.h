@@ -12,6 +12,7 @@ class UnknownElement : public BaseCardElement
 public:
     UnknownElement();
     Json::Value SerializeToJsonValue() const override;
+    std::shared_ptr<BaseElement> Clone() const override;
 };
 
 class UnknownElementParser : public BaseCardElementParser
@@ -48,51 +48,52 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
     return validBackgroundColor;
 }
 
-void ValidateUserInputForDimensionWithUnit(
-    const std::string& unit,
-    const std::string& requestedDimension,
-    std::optional<int>& parsedDimension,
-    std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
+std::errc ParseDimension(std::string_view input, ParsedDimension& dimension)
 {
-    constexpr auto warningMessage =
-        "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
-    std::string stringPattern = "^([1-9]+\\d*)(\\.\\d+)?";
-    stringPattern += ("(" + unit + ")$");
-    std::regex pattern(stringPattern);
-    std::smatch matches;
+    const auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
 
-    if (std::regex_search(requestedDimension, matches, pattern))
+    const auto integerEnd = std::find_if_not(input.begin(), input.end(), isDigit);
+    if (integerEnd == input.begin())
     {
-        try
-        {
-            // stoi will get integral value upto non digit char indexed by idx
-            parsedDimension = std::stoi(matches[0]);
-        }
-        catch (const std::invalid_argument&)
-        {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, warningMessage + requestedDimension));
-            }
-        }
-        catch (const std::out_of_range&)
-        {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, "out of range: " + requestedDimension));
-            }
-        }
+        return std::errc::invalid_argument;
     }
-    else
+
+    auto numberEnd = integerEnd;
+    if (numberEnd != input.end() && *numberEnd == '.')
     {
-        if (warnings)
+        numberEnd = std::find_if_not(numberEnd + 1, input.end(), isDigit);
+        if (numberEnd == integerEnd + 1)
         {
-            warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                WarningStatusCode::InvalidDimensionSpecified, warningMessage + requestedDimension));
+            return std::errc::invalid_argument;
         }
     }
+
+    const std::string_view unit = input.substr(numberEnd - input.begin());
+    if (!unit.empty() && unit != "px")
+    {
+        return std::errc::invalid_argument;
+    }
+
+    int wholeValue{};
+    const char* const integerDigits = input.data();
+    const size_t integerLength = integerEnd - input.begin();
+    if (std::from_chars(integerDigits, integerDigits + integerLength, wholeValue).ec != std::errc{})
+    {
+        return std::errc::result_out_of_range;
+    }
+
+    // weights are small, so summing the fraction digit by digit is precise enough
+    double value = wholeValue;
+    double scale = 0.1;
+    for (auto digit = integerEnd + 1; digit < numberEnd; ++digit, scale /= 10)
+    {
+        value += (*digit - '0') * scale;
+    }
+
+    dimension.unit = unit.empty() ? ParsedDimension::Unit::Weight : ParsedDimension::Unit::Pixels;
+    dimension.wholeValue = wholeValue;
+    dimension.value = value;
+    return std::errc{};
 }
 
 bool ShouldParseForExplicitDimension(const std::string& input)
@@ -128,8 +129,31 @@ std::optional<int> ParseSizeForPixelSize(const std::string& sizeString, std::vec
     std::optional<int> parsedSize{};
     if (ShouldParseForExplicitDimension(sizeString))
     {
-        const std::string unit = "px";
-        ValidateUserInputForDimensionWithUnit(unit, sizeString, parsedSize, warnings);
+        ParsedDimension dimension;
+        const std::errc result = ParseDimension(sizeString, dimension);
+
+        // pixel sizes need their unit, and can't start with a zero
+        const bool isPixelSize = sizeString.front() != '0' && sizeString.size() > 2 &&
+                                 sizeString.compare(sizeString.size() - 2, 2, "px") == 0;
+
+        if (isPixelSize && result == std::errc{})
+        {
+            parsedSize = dimension.wholeValue;
+        }
+        else if (warnings)
+        {
+            if (isPixelSize && result == std::errc::result_out_of_range)
+            {
+                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                    WarningStatusCode::InvalidDimensionSpecified, "out of range: " + sizeString));
+            }
+            else
+            {
+                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                    WarningStatusCode::InvalidDimensionSpecified,
+                    "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received " + sizeString));
+            }
+        }
     }
     return parsedSize;
 }
@@ -7,6 +7,26 @@
 
 std::string ValidateColor(const std::string& backgroundColor, std::vector<std::shared_ptr<AdaptiveCards::AdaptiveCardParseWarning>>& warnings);
 
+// A dimension as written in a card: a size in pixels ("50px") or a unitless weight ("2", "1.5")
+struct ParsedDimension
+{
+    enum class Unit
+    {
+        Pixels,
+        Weight
+    };
+
+    Unit unit{};
+    // the whole part of the number, which is all a pixel size uses
+    int wholeValue{};
+    double value{};
+};
+
+// Parses \d+(\.\d+)? optionally followed by "px", without allocating. Like std::from_chars, it returns
+// std::errc::invalid_argument for anything else and std::errc::result_out_of_range when the whole part
+// doesn't fit in an int, leaving dimension untouched in both cases.
+std::errc ParseDimension(std::string_view input, ParsedDimension& dimension);
+
 std::optional<int> ParseSizeForPixelSize(
     const std::string& sizeString, std::vector<std::shared_ptr<AdaptiveCards::AdaptiveCardParseWarning>>* warnings);
 
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "WorkerPool.h"
+
+namespace AdaptiveCards
+{
+namespace
+{
+// one call of WorkerPool::Run
+struct WorkerPoolJob
+{
+    const std::function<void()>* work;
+    std::mutex mutex;
+    std::condition_variable finished;
+    unsigned int running = 0;
+    bool done = false;
+};
+} // namespace
+
+WorkerPool& WorkerPool::GetShared()
+{
+    // never destroyed: its threads are still waiting on it when the process exits
+    static WorkerPool* pool = new WorkerPool();
+    return *pool;
+}
+
+void WorkerPool::Run(unsigned int workerCount, const std::function<void()>& work)
+{
+    const auto job = std::make_shared<WorkerPoolJob>();
+    job->work = &work;
+
+    if (workerCount > 1)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        _AddThreads(workerCount - 1);
+        for (unsigned int i = 1; i < workerCount; i++)
+        {
+            m_queue.push_back([job]() {
+                {
+                    std::lock_guard<std::mutex> jobLock(job->mutex);
+                    if (job->done)
+                    {
+                        return;
+                    }
+                    job->running++;
+                }
+
+                (*job->work)();
+
+                std::lock_guard<std::mutex> jobLock(job->mutex);
+                job->running--;
+                job->finished.notify_all();
+            });
+        }
+        m_workAdded.notify_all();
+    }
+
+    // the calling thread is a worker too
+    work();
+
+    // work lives on the caller's stack, so nothing may start on it from here on, and whatever has must finish
+    std::unique_lock<std::mutex> jobLock(job->mutex);
+    job->done = true;
+    job->finished.wait(jobLock, [&job]() { return job->running == 0; });
+}
+
+size_t WorkerPool::GetThreadCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_threadCount;
+}
+
+void WorkerPool::_AddThreads(size_t threadCount)
+{
+    for (; m_threadCount < threadCount; m_threadCount++)
+    {
+        try
+        {
+            std::thread(&WorkerPool::_WorkerLoop, this).detach();
+        }
+        catch (const std::system_error&)
+        {
+            // couldn't start another thread; make do with the ones we have (the caller does the work if need be)
+            break;
+        }
+    }
+}
+
+void WorkerPool::_WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_workAdded.wait(lock, [this]() { return !m_queue.empty(); });
+        const auto task = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace AdaptiveCards
+{
+// Threads that are kept for the life of the process and given work to do, so that work which is spread across
+// threads (such as AdaptiveCard::DeserializeBatch) doesn't start and stop threads of its own on every call. The pool
+// starts with no threads and adds them as work asks for more; they are never stopped.
+class WorkerPool
+{
+public:
+    // the pool shared by everything in the process
+    static WorkerPool& GetShared();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Calls work on the calling thread and on up to workerCount - 1 threads of the pool at once, and returns when
+    // every call has returned. work must not throw. A pool thread that only gets to it after the calling thread is
+    // done doesn't call it at all, so work should share out what there is to do (e.g. through a counter) rather than
+    // count on being called workerCount times.
+    void Run(unsigned int workerCount, const std::function<void()>& work);
+
+    size_t GetThreadCount() const;
+
+private:
+    WorkerPool() = default;
+
+    void _AddThreads(size_t threadCount);
+    void _WorkerLoop();
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_workAdded;
+    std::deque<std::function<void()>> m_queue;
+    size_t m_threadCount = 0;
+};
+} // namespace AdaptiveCards
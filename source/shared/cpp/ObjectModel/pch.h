@@ -3,17 +3,25 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
+#include <charconv>
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <locale>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <regex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -0,0 +1,445 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+
+#include "CardCache.h"
+#include "DateTimePreparser.h"
+#include "ElementTraversal.h"
+#include "FrozenCard.h"
+#include "JsonWriter.h"
+#include "MarkDownParser.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "TextBlock.h"
+#include "Util.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace AdaptiveCards;
+
+// Times the object model's hot paths and prints how long each took, so that changes to them can be compared from run
+// to run. Whether they give the right answers is for the unit tests (see AdaptiveCardsSharedModelUnitTest); nothing
+// here checks results. Run with the names of benchmarks to run only those.
+namespace
+{
+    // results are added up here so the work that produced them can't be optimized away
+    std::atomic<size_t> s_sink{0};
+
+    void Use(size_t value)
+    {
+        s_sink.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    template <typename Fn> double NanosecondsPerIteration(size_t iterations, Fn&& fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            fn(i);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    }
+
+    void Report(const std::string& name, std::initializer_list<std::pair<std::string, double>> timings)
+    {
+        std::cout << name << ":";
+        const char* separator = " ";
+        for (const auto& timing : timings)
+        {
+            std::cout << separator << timing.first << " " << std::fixed << std::setprecision(1) << timing.second << " ns";
+            separator = ", ";
+        }
+        std::cout << std::endl;
+    }
+
+    std::string MakeCardWithTextBlocks(size_t count)
+    {
+        std::string card = R"({ "type": "AdaptiveCard", "version": "1.0", "body": [)";
+        for (size_t i = 0; i < count; i++)
+        {
+            card += (i == 0 ? "" : ",");
+            card += R"({ "type": "TextBlock", "text": "Item )" + std::to_string(i) + R"(" })";
+        }
+        return card + "] }";
+    }
+
+    // Containers nested to the given depth, each with an id and a TextBlock of its own with an id
+    std::string MakeNestedContainers(const std::string& id, size_t depth)
+    {
+        std::string nested;
+        for (size_t level = 0; level < depth; level++)
+        {
+            const std::string levelId = id + "_" + std::to_string(level);
+            nested += R"({ "type": "Container", "id": ")" + levelId + R"(", "items": [ { "type": "TextBlock", "id": ")" +
+                levelId + R"(_text", "text": "text" })";
+            nested += (level + 1 < depth) ? "," : "";
+        }
+        for (size_t level = 0; level < depth; level++)
+        {
+            nested += "] }";
+        }
+        return nested;
+    }
+
+    // how a renderer finds the target of a toggle without an index: by walking the card
+    std::shared_ptr<BaseCardElement> FindByWalking(const std::shared_ptr<BaseCardElement>& element, const std::string& id)
+    {
+        if (element->GetId() == id)
+        {
+            return element;
+        }
+        std::shared_ptr<BaseCardElement> found;
+        VisitChildren(*element, [&](const auto& child) {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(child)>, std::shared_ptr<BaseActionElement>>)
+            {
+                found = found ? found : FindByWalking(child, id);
+            }
+        });
+        return found;
+    }
+
+    void ParseBenchmark()
+    {
+        const std::string card = MakeCardWithTextBlocks(1000);
+        const double perElement = NanosecondsPerIteration(20, [&](size_t) {
+            Use(AdaptiveCard::DeserializeFromString(card, "1.0")->GetAdaptiveCard()->GetBody().size());
+        }) / 1000;
+
+        // the lookups the parser makes for each element
+        constexpr size_t iterations = 100000;
+        const std::string elementTypes[] = {"TextBlock", "textblock", "Container", "Input.Text", "ColumnSet", "Image"};
+        const double enumLookup = NanosecondsPerIteration(iterations, [&](size_t i) {
+            Use(static_cast<size_t>(CardElementTypeFromString(elementTypes[i % std::size(elementTypes)])));
+        });
+        ElementParserRegistration registration;
+        const double parserLookup = NanosecondsPerIteration(iterations, [&](size_t i) {
+            Use(registration.GetParser(elementTypes[i % std::size(elementTypes)]) != nullptr);
+        });
+        // what GetParser cost when it wrapped the parser it found on every lookup
+        const double wrappingParserLookup = NanosecondsPerIteration(iterations, [&](size_t i) {
+            const auto& parser = registration.GetParser(elementTypes[i % std::size(elementTypes)]);
+            Use(parser != nullptr && std::make_shared<BaseCardElementParserWrapper>(parser) != nullptr);
+        });
+
+        Report("Parse",
+               {{"per TextBlock", perElement},
+                {"CardElementTypeFromString", enumLookup},
+                {"GetParser, wrapping each time", wrappingParserLookup},
+                {"GetParser", parserLookup}});
+    }
+
+    void IdValidationBenchmark()
+    {
+        // validating an element's id used to take time in proportion to how deeply it was nested
+        const auto parsePerElement = [](size_t depth) {
+            const size_t containers = 800 / depth;
+            std::string card = R"({ "type": "AdaptiveCard", "version": "1.2", "body": [)";
+            for (size_t i = 0; i < containers; i++)
+            {
+                card += (i == 0 ? "" : ",") + MakeNestedContainers("container" + std::to_string(i), depth);
+            }
+            card += "] }";
+
+            return NanosecondsPerIteration(5, [&](size_t) {
+                Use(AdaptiveCard::DeserializeFromString(card, "1.2")->GetAdaptiveCard()->GetBody().size());
+            }) / (containers * depth * 2);
+        };
+
+        // the same, as the parser drives the ParseContext but without the parsing, to see the validation alone
+        const auto validatePerElement = [](size_t depth) {
+            const size_t containers = 20000 / depth;
+            std::vector<std::string> ids;
+            for (size_t i = 0; i < containers * depth; i++)
+            {
+                ids.push_back("element" + std::to_string(i));
+            }
+
+            ParseContext context;
+            return NanosecondsPerIteration(5, [&](size_t) {
+                context.Reset();
+                auto id = ids.begin();
+                for (size_t i = 0; i < containers; i++)
+                {
+                    for (size_t level = 0; level < depth; level++)
+                    {
+                        context.PushElement(*id++, InternalId::Next());
+                    }
+                    for (size_t level = 0; level < depth; level++)
+                    {
+                        context.PopElement();
+                    }
+                }
+            }) / (containers * depth);
+        };
+
+        Report("Parse nested Containers, per element", {{"depth 10", parsePerElement(10)}, {"depth 200", parsePerElement(200)}});
+        Report("Validate ids of nested elements, per element", {{"depth 10", validatePerElement(10)}, {"depth 5000", validatePerElement(5000)}});
+    }
+
+    void SerializeBenchmark()
+    {
+        std::string json = R"({ "type": "AdaptiveCard", "version": "1.0", "body": [)";
+        for (size_t i = 0; i < 200; i++)
+        {
+            json += (i == 0 ? "" : ",");
+            json += R"({ "type": "Container", "style": "emphasis", "items": [
+                { "type": "TextBlock", "text": "Caf\u00e9 )" + std::to_string(i) + R"(", "weight": "bolder", "wrap": true },
+                { "type": "Image", "url": "https://adaptivecards.io/content/cats/1.png", "width": "40px" } ],
+                "selectAction": { "type": "Action.Submit", "data": { "id": )" + std::to_string(i) + R"( } } })";
+        }
+        json += "] }";
+        const auto card = AdaptiveCard::DeserializeFromString(json, "1.0")->GetAdaptiveCard();
+
+        // building the Json::Value and writing it out with jsoncpp, as a host can with SerializeToJsonValue
+        Json::StreamWriterBuilder builder;
+        builder["commentStyle"] = "None";
+        builder["indentation"] = "";
+        const double jsonValue = NanosecondsPerIteration(50, [&](size_t) {
+            Use(Json::writeString(builder, card->SerializeToJsonValue()).size());
+        }) / 200;
+
+        // a writer reused from card to card, the way a host serializing many cards can
+        JsonWriter writer;
+        const double jsonWriter = NanosecondsPerIteration(50, [&](size_t) {
+            writer.Clear();
+            card->SerializeTo(writer);
+            Use(writer.GetString().size());
+        }) / 200;
+
+        Report("Serialize, per Container", {{"Json::Value", jsonValue}, {"JsonWriter", jsonWriter}});
+    }
+
+    void CardCacheBenchmark()
+    {
+        const std::string json = MakeCardWithTextBlocks(100);
+        CardCache cache(16 * json.size());
+        cache.DeserializeFromString(json, "1.0");
+
+        const double parsed = NanosecondsPerIteration(200, [&](size_t) {
+            Use(AdaptiveCard::DeserializeFromString(json, "1.0")->GetAdaptiveCard()->GetBody().size());
+        });
+        const double fromCache = NanosecondsPerIteration(200, [&](size_t) {
+            Use(cache.DeserializeFromString(json, "1.0") != nullptr);
+        });
+
+        Report("Load 100 TextBlocks", {{"parsed", parsed}, {"cached", fromCache}});
+    }
+
+    void FrozenCardBenchmark()
+    {
+        const auto card = AdaptiveCard::DeserializeFromString(MakeCardWithTextBlocks(100), "1.0")->GetAdaptiveCard();
+
+        // what a renderer does for the text of each TextBlock
+        const auto render = [&](size_t) {
+            for (const auto& element : card->GetBody())
+            {
+                const auto textBlock = std::static_pointer_cast<TextBlock>(element);
+                Use(textBlock->GetTextForDateParsing()->HasDateTokens());
+                Use(textBlock->GetMarkDownResult(textBlock->GetText())->html.size());
+            }
+        };
+
+        const double unfrozen = NanosecondsPerIteration(50, render) / 100;
+        const auto frozen = FrozenCard::Freeze(card);
+        const double frozenRender = NanosecondsPerIteration(50, render) / 100;
+        Report("Render text, per TextBlock", {{"card", unfrozen}, {"frozen card", frozenRender}});
+    }
+
+    void CloneBenchmark()
+    {
+        const std::string json = MakeCardWithTextBlocks(100);
+        const auto card = AdaptiveCard::DeserializeFromString(json, "1.0")->GetAdaptiveCard();
+        card->GetBody().back()->SetId("name");
+
+        // a copy of the card for each recipient, with their name in the last TextBlock
+        const auto reparse = [&](size_t i) {
+            const auto copy = AdaptiveCard::DeserializeFromString(json, "1.0")->GetAdaptiveCard();
+            std::static_pointer_cast<TextBlock>(copy->GetBody().back())->SetText("Recipient " + std::to_string(i));
+        };
+        const auto clone = [&](size_t i) {
+            const auto copy = card->Clone();
+            std::static_pointer_cast<TextBlock>(copy->GetElementForEdit("name"))->SetText("Recipient " + std::to_string(i));
+        };
+
+        Report("Card per recipient", {{"reparsed", NanosecondsPerIteration(50, reparse)}, {"cloned", NanosecondsPerIteration(50, clone)}});
+    }
+
+    void ElementIndexBenchmark()
+    {
+        // a card of collapsible sections, each shown and hidden by a toggle
+        constexpr size_t sections = 300;
+        std::string json = R"({ "type": "AdaptiveCard", "version": "1.2", "body": [)";
+        for (size_t i = 0; i < sections; i++)
+        {
+            const std::string section = std::to_string(i);
+            json += (i == 0 ? "" : ",");
+            json += R"({ "type": "Container", "items": [ { "type": "TextBlock", "text": "Section )" + section +
+                R"(" }, { "type": "TextBlock", "id": "details)" + section + R"(", "text": "Details", "isVisible": false } ] })";
+        }
+        json += "] }";
+        const auto card = AdaptiveCard::DeserializeFromString(json, "1.2")->GetAdaptiveCard();
+
+        const auto walk = [&](size_t i) {
+            const std::string id = "details" + std::to_string(i % sections);
+            Use(std::any_of(card->GetBody().begin(), card->GetBody().end(), [&](const auto& element) {
+                return FindByWalking(element, id) != nullptr;
+            }));
+        };
+        const auto lookUp = [&](size_t i) {
+            Use(card->GetElementById("details" + std::to_string(i % sections)) != nullptr);
+        };
+
+        card->IndexElements();
+        Report("Find toggle target in 300 sections", {{"walk", NanosecondsPerIteration(sections, walk)}, {"index", NanosecondsPerIteration(sections, lookUp)}});
+
+        // an id the card doesn't have costs the walk that makes sure of it, but not a rebuild of the index
+        const auto walkMissing = [&](size_t i) {
+            const std::string id = "missing" + std::to_string(i);
+            Use(std::any_of(card->GetBody().begin(), card->GetBody().end(), [&](const auto& element) {
+                return FindByWalking(element, id) != nullptr;
+            }));
+        };
+        const auto lookUpMissing = [&](size_t i) { Use(card->GetElementById("missing" + std::to_string(i)) != nullptr); };
+        Report("Look up a missing id in 300 sections",
+               {{"walk", NanosecondsPerIteration(sections, walkMissing)}, {"index", NanosecondsPerIteration(sections, lookUpMissing)}});
+    }
+
+    void CaseInsensitiveLookupBenchmark()
+    {
+        std::vector<std::string> keys;
+        for (int key = static_cast<int>(AdaptiveCardSchemaKey::Accent); key <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); key++)
+        {
+            try
+            {
+                keys.push_back(AdaptiveCardSchemaKeyToString(static_cast<AdaptiveCardSchemaKey>(key)));
+            }
+            catch (const std::out_of_range&)
+            {
+                // not every key has a string
+            }
+        }
+
+        // look them up in a different case than they were added in, as the parser often has to
+        std::unordered_map<std::string, size_t, CaseInsensitiveHash, CaseInsensitiveEqualTo> map;
+        std::vector<std::string> lookups;
+        for (const auto& key : keys)
+        {
+            map.emplace(key, map.size());
+            std::string upper = key;
+            std::transform(upper.begin(), upper.end(), upper.begin(), [](char c) { return ToUpperAscii(c); });
+            lookups.push_back(upper);
+        }
+
+        const double lookup = NanosecondsPerIteration(lookups.size() * 20, [&](size_t i) {
+            Use(map.count(lookups[i % lookups.size()]));
+        });
+        Report("Schema key lookup", {{"CaseInsensitiveHash", lookup}});
+    }
+
+    void DateTimePreparserBenchmark()
+    {
+        const std::string texts[] = {
+            "Your order shipped",
+            "Arriving {{DATE(2017-10-27T22:27:00-04:00, SHORT)}} at {{TIME(2017-10-27T22:27:00-04:00)}}, {{not a date}}",
+            "Due {{DATE(2017-02-13T20:46:30Z)}}"};
+
+        // reusing the token buffer the way a renderer can
+        DateTimePreparser preparser;
+        const double preparse = NanosecondsPerIteration(20000, [&](size_t i) {
+            preparser.Parse(texts[i % std::size(texts)]);
+            Use(preparser.GetTokens().size());
+        });
+        Report("Date/time preparse", {{"per text", preparse}});
+    }
+
+    void HtmlEntityBenchmark()
+    {
+        TextBlock textBlock;
+        const auto setText = [&](const std::string& text) {
+            return NanosecondsPerIteration(20000, [&](size_t) {
+                textBlock.SetText(text);
+                Use(textBlock.GetText().size());
+            });
+        };
+
+        Report(
+            "SetText",
+            {{"no entities", setText("A plain sentence of the length a FactSet value usually has, with no entities in it at all")},
+             {"with entities", setText("Tom &amp; Jerry &lt;tom@example.com&gt; said &quot;hi&quot;&nbsp;to &unknown; people & pets")}});
+    }
+
+    void PixelSizeBenchmark()
+    {
+        const std::string sizes[] = {"50px", "120.5px", "2", "1.5px", "stretch"};
+        const double parse = NanosecondsPerIteration(20000, [&](size_t i) {
+            Use(ParseSizeForPixelSize(sizes[i % std::size(sizes)], nullptr).value_or(0));
+        });
+        Report("Pixel size parse", {{"per size", parse}});
+    }
+
+    void MarkDownBenchmark()
+    {
+        // the first has no markdown, so it takes the plain text path that skips parsing
+        const std::string texts[] = {
+            "A plain sentence of the length a TextBlock usually has, with no markdown in it at all",
+            "Some **bold** and _italic_ text, and a [link](https://adaptivecards.io) & more",
+            "- first item\r- second *item*\r\r1. one\r2. two"};
+
+        for (const auto& text : texts)
+        {
+            const double transform = NanosecondsPerIteration(20000, [&](size_t) {
+                MarkDownParser parser(text);
+                Use(parser.TransformToHtml().size());
+            });
+            Report("TransformToHtml", {{std::to_string(text.size()) + " chars", transform}});
+        }
+    }
+
+    void TextMemoizationBenchmark()
+    {
+        TextBlock textBlock;
+        textBlock.SetText("Arriving {{DATE(2017-10-27T22:27:00-04:00, SHORT)}}, **don't** miss it");
+        const std::string formattedText = "Arriving Fri, Oct 27, 2017, **don't** miss it";
+
+        // what a renderer does for a TextBlock each time the card is rendered again
+        const auto render = [&](size_t) {
+            Use(textBlock.GetTextForDateParsing()->HasDateTokens());
+            Use(textBlock.GetMarkDownResult(formattedText)->hasHtmlTags);
+        };
+
+        const double processed = NanosecondsPerIteration(20000, render);
+        textBlock.SetTextMemoizationEnabled(true);
+        const double memoized = NanosecondsPerIteration(20000, render);
+        Report("Render text, per TextBlock", {{"processed", processed}, {"memoized", memoized}});
+    }
+
+    const std::pair<const char*, void (*)()> c_benchmarks[] = {
+        {"Parse", ParseBenchmark},
+        {"IdValidation", IdValidationBenchmark},
+        {"Serialize", SerializeBenchmark},
+        {"CardCache", CardCacheBenchmark},
+        {"FrozenCard", FrozenCardBenchmark},
+        {"Clone", CloneBenchmark},
+        {"ElementIndex", ElementIndexBenchmark},
+        {"CaseInsensitiveLookup", CaseInsensitiveLookupBenchmark},
+        {"DateTimePreparser", DateTimePreparserBenchmark},
+        {"HtmlEntity", HtmlEntityBenchmark},
+        {"PixelSize", PixelSizeBenchmark},
+        {"MarkDown", MarkDownBenchmark},
+        {"TextMemoization", TextMemoizationBenchmark}};
+}
+
+int main(int argc, char* argv[])
+{
+    for (const auto& benchmark : c_benchmarks)
+    {
+        if (argc == 1 || std::any_of(argv + 1, argv + argc, [&](const char* name) { return benchmark.first == std::string(name); }))
+        {
+            benchmark.second();
+        }
+    }
+    return 0;
+}
@@ -28,16 +28,16 @@ namespace AdaptiveCards::Rendering::Uwp
             parsedostr.imbue(language);
         }
 
-        for (const auto& textSection : text.GetTextTokens())
+        for (const auto& textSection : text.GetTokens())
         {
             std::tm result = {};
 
-            result.tm_mday = textSection->GetDay();
-            result.tm_mon = textSection->GetMonth();
-            result.tm_year = textSection->GetYear() >= 1900 ? textSection->GetYear() - 1900 : 0;
+            result.tm_mday = textSection.GetDay();
+            result.tm_mon = textSection.GetMonth();
+            result.tm_year = textSection.GetYear() >= 1900 ? textSection.GetYear() - 1900 : 0;
 
             // using the put_time function the 3 formats are locale dependent
-            switch (textSection->GetFormat())
+            switch (textSection.GetFormat())
             {
             case DateTimePreparsedTokenFormat::DateCompact:
                 parsedostr << std::put_time(&result, "%Ex");
@@ -52,7 +52,7 @@ namespace AdaptiveCards::Rendering::Uwp
                 break;
             case DateTimePreparsedTokenFormat::RegularString:
             default:
-                parsedostr << textSection->GetText();
+                parsedostr << textSection.GetText();
                 break;
             }
         }